@@ -170,6 +170,21 @@ EFI_STATUS EFIAPI UefiMain(
     case PixelBlueGreenRedReserved8BitPerColor:
       config.pixel_format = kPixelBGRResv8BitPerColor;
       break;
+    case PixelBitMask: {
+      EFI_PIXEL_BITMASK* mask = &gop->Mode->Info->PixelInformation;
+      if (mask->RedMask == 0xf800 && mask->GreenMask == 0x07e0 && mask->BlueMask == 0x001f) {
+        config.pixel_format = kPixelRGB565;
+        break;
+      }
+      if (mask->RedMask == 0xff0000 && mask->GreenMask == 0x00ff00 && mask->BlueMask == 0x0000ff &&
+          mask->ReservedMask == 0) {
+        config.pixel_format = kPixelBGR8BitPerColor;
+        break;
+      }
+      Print(L"Unimplemented pixel mask: r=%08x g=%08x b=%08x\n",
+          mask->RedMask, mask->GreenMask, mask->BlueMask);
+      Halt();
+    }
     default:
       Print(L"Unimplemented pixel format: %d\n", gop->Mode->Info->PixelFormat);
       Halt();
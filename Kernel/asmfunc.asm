@@ -19,6 +19,19 @@ IoIn32:
     in eax, dx
     ret
 
+global IoOut8  ; void IoOut8(uint16_t addr, uint8_t data);
+IoOut8:
+    mov dx, di    ; dx = addr
+    mov al, sil   ; al = data
+    out dx, al
+    ret
+
+global IoIn8  ; uint8_t IoIn8(uint16_t addr);
+IoIn8:
+    mov dx, di    ; dx = addr
+    in al, dx
+    ret
+
 global LoadIDT ; void LoadIDT(uint16_t limit, uint64_t offset);
 LoadIDT:
     push rbp
@@ -254,6 +267,13 @@ IntHandlerLAPICTimer:
     pop rbp
     iretq
 
+global ReadTSC
+ReadTSC:    ; uint64_t ReadTSC();
+    rdtsc
+    shl rdx, 32
+    or rax, rdx
+    ret
+
 global WriteMSR
 WriteMSR:   ; void WriteMSR(uint32_t msr, uint64_t value)
     mov rdx, rsi
@@ -5,6 +5,8 @@
 extern "C" {
   void IoOut32(uint16_t addr, uint32_t data);
   uint32_t IoIn32(uint16_t addr);
+  void IoOut8(uint16_t addr, uint8_t data);
+  uint8_t IoIn8(uint16_t addr);
   uint16_t GetCS(void);
   void LoadIDT(uint16_t limit, uint64_t offset);
   void LoadGDT(uint16_t limit, uint64_t offset);
@@ -18,5 +20,6 @@ extern "C" {
   void CallApp(int argc, char** argv, uint16_t ss, uint64_t rip, uint64_t rsp, uint64_t* os_stack_ptr);
   void IntHandlerLAPICTimer(); 
   void WriteMSR(uint32_t msr, uint64_t value);
+  uint64_t ReadTSC();
   void SyscallEntry();
 }
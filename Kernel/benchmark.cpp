@@ -0,0 +1,312 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <memory>
+#include <limits>
+
+#include "benchmark.hpp"
+#include "terminal.hpp"
+#include "layer.hpp"
+#include "window.hpp"
+#include "frame_buffer.hpp"
+#include "font.hpp"
+#include "timer.hpp"
+#include "asmfunc.h"
+
+namespace {
+  // 重なり合ったウィンドウを並べ、画面全体の再描画にかかる時間と重ね描きの割合を測る
+  void BenchmarkDraw(Terminal& terminal, int count) {
+    const int kNumWindows = 16;
+    std::vector<unsigned int> layer_ids;
+    for(int i = 0; i < kNumWindows; i++) {
+      auto window = std::make_shared<ToplevelWindow>(320, 240, window_pixel_format, "bench");
+      layer_ids.push_back(layer_manager->NewLayer()
+        .SetWindow(window)
+        .Move({40 + 24 * i, 40 + 16 * i})
+        .ID());
+      layer_manager->UpDown(layer_ids.back(), 2 + i);
+    }
+
+    char s[128];
+    const Rectangle<int> screen_area{{0, 0}, ScreenSize()};
+    for(bool culling : {false, true}) {
+      layer_manager->SetOcclusionCulling(culling);
+      layer_manager->ResetDrawStatistics();
+
+      const auto start = ReadTSC();
+      for(int i = 0; i < count; i++) {
+        layer_manager->Draw(screen_area);
+      }
+      const auto elapsed = ReadTSC() - start;
+
+      const auto overdraw_x100 = layer_manager->ComposedPixels() * 100 / layer_manager->DamagedPixels();
+      sprintf(s, "culling %-3s: %lu us/frame, overdraw %lu.%02lux\n",
+        culling ? "on" : "off", TSCToMicroseconds(elapsed / count),
+        overdraw_x100 / 100, overdraw_x100 % 100);
+      terminal.Print(s);
+    }
+    layer_manager->SetOcclusionCulling(true);
+
+    for(auto id : layer_ids) {
+      layer_manager->RemoveLayer(id);
+    }
+    layer_manager->Draw(screen_area);
+  }
+
+  // 画面と同じ大きさのウィンドウについて、使用メモリと書き込み・転送の速さを測る
+  void BenchmarkWindow(Terminal& terminal, int count) {
+    const auto size = ScreenSize();
+    const auto pixels = static_cast<uint64_t>(size.x) * size.y;
+    Window window{size.x, size.y, window_pixel_format};
+    FrameBuffer dst;
+    FrameBufferConfig dst_config = screen_config;
+    dst_config.frame_buffer = nullptr;
+    dst.Initialize(dst_config);
+
+    char s[128];
+    // 以前の実装は行ごとの vector<PixelColor> と影バッファを二重に持っていた
+    const uint64_t old_bytes = size.y * (sizeof(std::vector<PixelColor>) + size.x * 3 /* RGB */)
+                             + pixels * 4;
+    sprintf(s, "window %dx%d: %lu KiB (was %lu KiB)\n",
+      size.x, size.y, window.BufferBytes() / 1024, old_bytes / 1024);
+    terminal.Print(s);
+
+    auto report = [&](const char* name, uint64_t elapsed) {
+      const auto us = TSCToMicroseconds(elapsed);
+      sprintf(s, "%-12s: %lu us/frame, %lu Mpixel/s\n",
+        name, us / count, us == 0 ? 0 : pixels * count / us);
+      terminal.Print(s);
+    };
+
+    auto start = ReadTSC();
+    for(int i = 0; i < count; i++) {
+      FillRectangle(*window.Writer(), {0, 0}, size, ToColor(i & 1 ? 0x000000 : 0xFFFFFF));
+    }
+    report("fill", ReadTSC() - start);
+
+    const Rectangle<int> area{{0, 0}, size};
+    start = ReadTSC();
+    for(int i = 0; i < count; i++) {
+      window.DrawTo(dst, {0, 0}, area);
+    }
+    report("copy", ReadTSC() - start);
+
+    window.SetTransparentColor(ToColor(0x000000));
+    start = ReadTSC();
+    for(int i = 0; i < count; i++) {
+      window.DrawTo(dst, {0, 0}, area);
+    }
+    report("transparent", ReadTSC() - start);
+  }
+
+  // 1画素ずつ Write する場合と、まとめて塗る場合の矩形塗りつぶしの速さを比べる
+  void BenchmarkFill(Terminal& terminal, int count) {
+    const Vector2D<int> size{200, 150};
+    Window window{size.x, size.y, window_pixel_format};
+    auto& writer = *window.Writer();
+    const auto pixels = static_cast<uint64_t>(size.x) * size.y * count;
+
+    char s[128];
+    auto report = [&](const char* name, uint64_t elapsed) {
+      const auto us = TSCToMicroseconds(elapsed);
+      sprintf(s, "%-10s: %lu us, %lu Mpixel/s\n", name, us, us == 0 ? 0 : pixels / us);
+      terminal.Print(s);
+    };
+
+    auto start = ReadTSC();
+    for(int i = 0; i < count; i++) {
+      const auto c = ToColor(i & 1 ? 0x000000 : 0xFFFFFF);
+      for(int y = 0; y < size.y; y++) {
+        for(int x = 0; x < size.x; x++) {
+          writer.Write({x, y}, c);
+        }
+      }
+    }
+    report("per-pixel", ReadTSC() - start);
+
+    start = ReadTSC();
+    for(int i = 0; i < count; i++) {
+      FillRectangle(writer, {0, 0}, size, ToColor(i & 1 ? 0x000000 : 0xFFFFFF));
+    }
+    report("fill rect", ReadTSC() - start);
+  }
+
+  // ウィンドウに文字列を書き込む速さを測る
+  void BenchmarkText(Terminal& terminal, int count) {
+    const int kColumns = 80, kRows = 25;
+    Window window{8 * kColumns, 16 * kRows, window_pixel_format};
+    auto& writer = *window.Writer();
+
+    char line[kColumns + 1];
+    for(int i = 0; i < kColumns; i++) {
+      line[i] = ' ' + 1 + i % 94;
+    }
+    line[kColumns] = '\0';
+
+    const uint64_t chars = static_cast<uint64_t>(kColumns) * kRows * count;
+    char s[128];
+    for(bool opaque : {false, true}) {
+      const auto stats_before = GetGlyphCacheStatistics();
+      const auto start = ReadTSC();
+      for(int i = 0; i < count; i++) {
+        for(int row = 0; row < kRows; row++) {
+          if(opaque) {
+            WriteString(writer, {0, 16 * row}, line, ToColor(0xFFFFFF), ToColor(0x000000));
+          } else {
+            WriteString(writer, {0, 16 * row}, line, ToColor(0xFFFFFF));
+          }
+        }
+      }
+      const auto us = TSCToMicroseconds(ReadTSC() - start);
+      const auto stats = GetGlyphCacheStatistics();
+
+      sprintf(s, "%-11s: %lu chars in %lu us, %lu chars/s, cache miss %lu\n",
+        opaque ? "opaque" : "transparent", chars, us, us == 0 ? 0 : chars * 1000000 / us,
+        stats.misses - stats_before.misses);
+      terminal.Print(s);
+    }
+  }
+
+  // 影付きの半透明ウィンドウを重ね、アルファ合成の有無と不透明範囲のヒントで合成速度を比べる
+  void BenchmarkAlpha(Terminal& terminal, int count) {
+    const int kNumWindows = 16;
+    const int kShadow = 8;
+    const Vector2D<int> content_size{320, 240};
+    std::vector<std::shared_ptr<Window>> windows;
+    std::vector<unsigned int> layer_ids;
+    for(int i = 0; i < kNumWindows; i++) {
+      auto window = std::make_shared<Window>(
+        content_size.x + kShadow, content_size.y + kShadow, window_pixel_format);
+      auto& writer = *window->Writer();
+      FillRectangle(writer, {0, 0}, window->Size(), PixelColor{0, 0, 0, 0});
+      FillRectangle(writer, {kShadow, kShadow}, content_size, PixelColor{0, 0, 0, 96});
+      FillRectangle(writer, {0, 0}, content_size, ToColor(0xC6C6C6));
+      windows.push_back(window);
+      layer_ids.push_back(layer_manager->NewLayer()
+        .SetWindow(window)
+        .Move({40 + 24 * i, 40 + 16 * i})
+        .ID());
+      layer_manager->UpDown(layer_ids.back(), 2 + i);
+    }
+
+    char s[128];
+    const Rectangle<int> screen_area{{0, 0}, ScreenSize()};
+    const char* names[] = {"opaque", "alpha", "alpha+hint"};
+    for(int mode = 0; mode < 3; mode++) {
+      for(auto& window : windows) {
+        window->SetAlphaBlending(mode > 0);
+        window->SetOpaqueHint(mode == 2 ? Rectangle<int>{{0, 0}, content_size} : Rectangle<int>{{0, 0}, {0, 0}});
+      }
+
+      const auto start = ReadTSC();
+      for(int i = 0; i < count; i++) {
+        layer_manager->Draw(screen_area);
+      }
+      const auto elapsed = ReadTSC() - start;
+
+      sprintf(s, "%-10s: %lu us/frame\n", names[mode], TSCToMicroseconds(elapsed / count));
+      terminal.Print(s);
+    }
+
+    for(auto id : layer_ids) {
+      layer_manager->RemoveLayer(id);
+    }
+    layer_manager->Draw(screen_area);
+  }
+
+  // 小さなウィンドウを count 個散らして置き、当たり判定と小さな領域の再描画にかかる時間を測る
+  void BenchmarkLayers(Terminal& terminal, int count) {
+    const auto screen_size = ScreenSize();
+    const Vector2D<int> size{48, 32};
+    std::vector<unsigned int> layer_ids;
+    for(int i = 0; i < count; i++) {
+      auto window = std::make_shared<Window>(size.x, size.y, window_pixel_format);
+      FillRectangle(*window->Writer(), {0, 0}, size, ToColor(0x404040 + 0x10 * (i % 8)));
+      const Vector2D<int> pos{(i * 97) % (screen_size.x - size.x), (i * 61) % (screen_size.y - size.y)};
+      layer_ids.push_back(layer_manager->NewLayer()
+        .SetWindow(window)
+        .Move(pos)
+        .ID());
+      layer_manager->UpDown(layer_ids.back(), std::numeric_limits<int>::max());
+    }
+
+    const int kIterations = 1000;
+    auto start = ReadTSC();
+    for(int i = 0; i < kIterations; i++) {
+      layer_manager->FindLayerByPosition({(i * 37) % screen_size.x, (i * 53) % screen_size.y}, 0);
+    }
+    const auto hit_ns = TSCToNanoseconds(ReadTSC() - start) / kIterations;
+
+    start = ReadTSC();
+    for(int i = 0; i < kIterations; i++) {
+      layer_manager->Draw({{(i * 37) % screen_size.x, (i * 53) % screen_size.y}, {16, 16}});
+    }
+    const auto draw_ns = TSCToNanoseconds(ReadTSC() - start) / kIterations;
+
+    char s[128];
+    sprintf(s, "%d layers: hit test %lu ns, 16x16 redraw %lu ns\n", count, hit_ns, draw_ns);
+    terminal.Print(s);
+
+    for(auto id : layer_ids) {
+      layer_manager->RemoveLayer(id);
+    }
+    layer_manager->Draw({{0, 0}, screen_size});
+  }
+
+  // ウィンドウが重なった画面全体を合成する速さを測る
+  void BenchmarkCompose(Terminal& terminal, int count) {
+    const int kNumWindows = 16;
+    std::vector<unsigned int> layer_ids;
+    for(int i = 0; i < kNumWindows; i++) {
+      auto window = std::make_shared<ToplevelWindow>(320, 240, window_pixel_format, "bench");
+      layer_ids.push_back(layer_manager->NewLayer()
+        .SetWindow(window)
+        .Move({40 + 24 * i, 40 + 16 * i})
+        .ID());
+      layer_manager->UpDown(layer_ids.back(), 2 + i);
+    }
+
+    char s[128];
+    const Rectangle<int> screen_area{{0, 0}, ScreenSize()};
+    const uint64_t pixels = static_cast<uint64_t>(screen_area.size.x) * screen_area.size.y;
+    const auto start = ReadTSC();
+    for(int i = 0; i < count; i++) {
+      layer_manager->Draw(screen_area);
+    }
+    const auto us = TSCToMicroseconds(ReadTSC() - start);
+
+    sprintf(s, "compose: %lu us/frame, %lu Mpixel/s\n",
+      us / count, us == 0 ? 0 : pixels * count / us);
+    terminal.Print(s);
+
+    for(auto id : layer_ids) {
+      layer_manager->RemoveLayer(id);
+    }
+    layer_manager->Draw(screen_area);
+  }
+}
+
+bool RunBenchmark(Terminal& terminal, const char* name, const char* arg) {
+  const int count = arg ? atoi(arg) : 0;
+
+  if(strcmp(name, "draw") == 0) {
+    BenchmarkDraw(terminal, count > 0 ? count : 20);
+  } else if(strcmp(name, "alpha") == 0) {
+    BenchmarkAlpha(terminal, count > 0 ? count : 20);
+  } else if(strcmp(name, "compose") == 0) {
+    BenchmarkCompose(terminal, count > 0 ? count : 20);
+  } else if(strcmp(name, "layers") == 0) {
+    BenchmarkLayers(terminal, count > 0 ? count : 200);
+  } else if(strcmp(name, "fill") == 0) {
+    BenchmarkFill(terminal, count > 0 ? count : 100);
+  } else if(strcmp(name, "text") == 0) {
+    BenchmarkText(terminal, count > 0 ? count : 10);
+  } else if(strcmp(name, "window") == 0) {
+    BenchmarkWindow(terminal, count > 0 ? count : 10);
+  } else {
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+class Terminal;
+
+// ターミナルの bench コマンドから呼ばれる性能計測。結果はターミナルに出力する。
+// name に対応する計測がなければ false を返す
+bool RunBenchmark(Terminal& terminal, const char* name, const char* arg);
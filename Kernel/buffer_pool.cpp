@@ -0,0 +1,83 @@
+#include "buffer_pool.hpp"
+#include "memory_manager.hpp"
+#include "interrupt.hpp"
+
+WithError<uint32_t> BufferPool::Allocate() {
+  InterruptGuard guard;
+  for(int i = 0; i < kNumBuffers; i++) {
+    auto& slot = slots_[i];
+    if(slot.refcount > 0) {
+      continue;
+    }
+
+    // フレームは初めて使うときに確保し、以降は解放せずに使い回す
+    if(slot.data == nullptr) {
+      auto [frame, err] = memory_manager->Allocate(kFramesPerBuffer);
+      if(err) {
+        return { 0, err };
+      }
+      slot.data = reinterpret_cast<uint8_t*>(frame.Frame());
+    }
+
+    slot.refcount = 1;
+    slot.generation++;
+    return { static_cast<uint32_t>(slot.generation) << 16 | (i + 1), MAKE_ERROR(Error::kSuccess) };
+  }
+
+  return { 0, MAKE_ERROR(Error::kFull) };
+}
+
+Error BufferPool::AddRef(uint32_t handle) {
+  InterruptGuard guard;
+  auto slot = Lookup(handle);
+  if(slot == nullptr) {
+    return MAKE_ERROR(Error::kIndexOutOfRange);
+  }
+
+  slot->refcount++;
+  return MAKE_ERROR(Error::kSuccess);
+}
+
+Error BufferPool::Release(uint32_t handle) {
+  InterruptGuard guard;
+  auto slot = Lookup(handle);
+  if(slot == nullptr) {
+    return MAKE_ERROR(Error::kIndexOutOfRange);
+  }
+
+  slot->refcount--;
+  return MAKE_ERROR(Error::kSuccess);
+}
+
+uint8_t* BufferPool::Data(uint32_t handle) {
+  InterruptGuard guard;
+  auto slot = Lookup(handle);
+  return slot ? slot->data : nullptr;
+}
+
+int BufferPool::FreeCount() const {
+  int count = 0;
+  for(const auto& slot : slots_) {
+    if(slot.refcount == 0) {
+      count++;
+    }
+  }
+  return count;
+}
+
+BufferPool::Slot* BufferPool::Lookup(uint32_t handle) {
+  const int index = static_cast<int>(handle & 0xFFFFu) - 1;
+  if(index < 0 || index >= kNumBuffers) {
+    return nullptr;
+  }
+
+  auto& slot = slots_[index];
+  if(slot.refcount == 0 || slot.generation != (handle >> 16)) {
+    return nullptr;
+  }
+  return &slot;
+}
+
+void InitializeBufferPool() {
+  buffer_pool = new BufferPool;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+
+#include "error.hpp"
+#include "memory_manager.hpp"
+
+// タスク間でコピーせずにまとまったデータを受け渡すための参照カウント付きバッファ。
+// ハンドルを Message::kBuffer に載せて送ると、送信側の参照の所有権も受信側に移る。
+// 受信側は使い終わったら Release し、参照が0になったバッファはプールに戻る
+class BufferPool {
+  public:
+    static const size_t kFramesPerBuffer = 16;
+    static const size_t kBufferBytes = kFramesPerBuffer * kBytesPerFrame;
+    static const int kNumBuffers = 32;
+
+    WithError<uint32_t> Allocate();
+    Error AddRef(uint32_t handle);
+    Error Release(uint32_t handle);
+    uint8_t* Data(uint32_t handle);
+    int FreeCount() const;
+
+  private:
+    struct Slot {
+      uint8_t* data{nullptr};
+      uint32_t refcount{0};
+      uint16_t generation{0};
+    };
+
+    std::array<Slot, kNumBuffers> slots_{};
+
+    // ハンドルは下位16ビットが添字+1、上位16ビットが世代番号。
+    // 解放済みのバッファを指す古いハンドルは世代番号で弾く
+    Slot* Lookup(uint32_t handle);
+};
+
+inline BufferPool* buffer_pool;
+
+void InitializeBufferPool();
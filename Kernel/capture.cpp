@@ -0,0 +1,57 @@
+#include "capture.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "frame_buffer.hpp"
+#include "layer.hpp"
+#include "serial.hpp"
+#include "timer.hpp"
+
+Error CaptureScreen(Rectangle<int> area) {
+  if(!SerialAvailable()) {
+    return MAKE_ERROR(Error::kNoSerialPort);
+  }
+
+  area = area & Rectangle<int>{{0, 0}, ScreenSize()};
+  if(IsEmpty(area)) {
+    return MAKE_ERROR(Error::kIndexOutOfRange);
+  }
+
+  // 送っているあいだも合成を止めないよう、先にコピーを取る
+  FrameBuffer copy;
+  if(auto err = layer_manager->CopyBackBuffer(copy, area)) {
+    return err;
+  }
+
+  const auto frames = layer_manager->ComposeFrames();
+  const auto avg_us = frames == 0 ? 0 : TSCToMicroseconds(layer_manager->ComposeTSC()) / frames;
+  const auto max_us = TSCToMicroseconds(layer_manager->MaxComposeTSC());
+
+  char s[128];
+  sprintf(s, "@@CAPTURE %d %d %d %d frames=%lu avg_us=%lu max_us=%lu\n",
+      area.pos.x, area.pos.y, area.size.x, area.size.y, frames, avg_us, max_us);
+  SerialWrite(s);
+  sprintf(s, "P6\n%d %d\n255\n", area.size.x, area.size.y);
+  SerialWrite(s);
+
+  const auto format = copy.Config().pixel_format;
+  uint8_t row[3 * 256];
+  for(int y = 0; y < area.size.y; ++y) {
+    for(int x0 = 0; x0 < area.size.x; x0 += 256) {
+      const int n = std::min(256, area.size.x - x0);
+      auto src = reinterpret_cast<const uint32_t*>(copy.PixelAt({x0, y}));
+      for(int i = 0; i < n; ++i) {
+        const auto c = DecodePixel(format, src[i]);
+        row[3 * i] = c.r;
+        row[3 * i + 1] = c.g;
+        row[3 * i + 2] = c.b;
+      }
+      SerialWrite(row, 3 * n);
+    }
+  }
+
+  SerialWrite("\n@@END\n");
+  SerialFlush();
+  return MAKE_ERROR(Error::kSuccess);
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "graphics.hpp"
+#include "error.hpp"
+
+// 合成済みの画面の area を PPM (P6) にしてシリアルポートへ送る。
+// ホスト側 (tools/capture_test.py) がほかの出力と区別できるよう、次の形で送る
+//   @@CAPTURE x y w h frames=N avg_us=N max_us=N
+//   <PPM>
+//   @@END
+// frames などは前回の統計のリセットからの LayerManager::Compose の回数と時間
+Error CaptureScreen(Rectangle<int> area);
\ No newline at end of file
@@ -18,11 +18,7 @@ Console::Console(const PixelColor& fg_color, const PixelColor& bg_color)
 
 // 画面を初期化する。
 void Console::Clear() {
-  for(int y = 0; y < writer_->Height(); y++) {
-    for(int x = 0; x < writer_->Width(); x++) {
-      writer_->Write(Vector2D<int>{x, y}, bg_color_);
-    }    
-  }
+  writer_->FillRect({{0, 0}, {writer_->Width(), writer_->Height()}}, bg_color_);
 
   for(int row = 0; row < kRows; row++) {
     memset(buffer_[row], 0, kColumns + 1);
@@ -38,7 +34,7 @@ void Console::PutString(const char* s) {
       // kColumnsまで描画できる。
     } else if(cursor_column_ < kColumns){
       auto pos = Vector2D<int>{cursor_column_ * 8, cursor_row_ * 16};
-      WriteAscii(*writer_, pos, *s, fg_color_);
+      WriteAscii(*writer_, pos, *s, fg_color_, bg_color_);
       buffer_[cursor_row_][cursor_column_] = *s;
       cursor_column_++;
     }
@@ -47,7 +43,7 @@ void Console::PutString(const char* s) {
   }
 
   if(layer_manager) {
-    layer_manager->Draw(layer_id_);
+    layer_manager->Invalidate(layer_id_);
   }
 }
 
@@ -94,7 +90,7 @@ void Console::Newline() {
     FillRectangle(*writer_, {0, 0}, {8 * kColumns, 16 * kRows}, bg_color_);
     for(int row = 0; row < kRows - 1; row++) {
       memcpy(buffer_[row], buffer_[row + 1], kColumns + 1);
-      WriteString(*writer_, Vector2D<int>{0, 16 * row}, buffer_[row], fg_color_);
+      WriteString(*writer_, Vector2D<int>{0, 16 * row}, buffer_[row], fg_color_, bg_color_);
     }
     memset(buffer_[kRows - 1], 0, kColumns + 1);
   }
@@ -31,6 +31,8 @@ class Error {
     kNoSuchTask,
     kInvalidFormat,
     kFrameTooSmall,
+    kNoSerialPort,
+    kNoSuchFile,
     kLastOfCode,  // この列挙子は常に最後に配置する
   };
 
@@ -61,6 +63,8 @@ class Error {
     "kNoSuchTask",
     "kInvalidFormat",
     "kFrameTooSmall",
+    "kNoSerialPort",
+    "kNoSuchFile",
   };
   static_assert(Error::Code::kLastOfCode == code_names_.size());
 
@@ -1,35 +1,182 @@
+#include <emmintrin.h>
+
 #include "graphics.hpp"
 #include "font.hpp"
+#include "hankaku_font.hpp"
+#include "frame_buffer.hpp"
+#include "interrupt.hpp"
 
-extern const uint8_t _binary_hankaku_bin_start;
-extern const uint8_t _binary_hankaku_bin_end;
-extern const uint8_t _binary_hankaku_bin_size;
+namespace {
+  // 1行8画素分のビットパターンを、画素ごとの 32 ビットマスクに展開した表
+  alignas(16) uint32_t pixel_masks[256][8];
+  bool pixel_masks_ready = false;
 
-const uint8_t* GetFont(char c) {
-  auto index = 16 * static_cast<unsigned int>(c);
-  if(index >= reinterpret_cast<uintptr_t>(&_binary_hankaku_bin_size)) {
-    return nullptr;
+  void InitializePixelMasks() {
+    for(int bits = 0; bits < 256; bits++) {
+      for(int x = 0; x < 8; x++) {
+        pixel_masks[bits][x] = ((bits << x) & 0x80) ? 0xFFFFFFFF : 0;
+      }
+    }
+    pixel_masks_ready = true;
   }
 
-  return &_binary_hankaku_bin_start + index;
-}
+  // グリフを描画先の形式の画素に展開したもの。透過の場合、文字以外の画素は 0 にしておく
+  template <typename FontT>
+  struct CachedGlyph {
+    alignas(16) uint32_t pixels[FontT::kHeight][FontT::kWidth];
+    const FontGlyph<FontT::kHeight>* glyph;
+    uint32_t fg, bg;
+    PixelFormat format;
+    bool opaque;
+    bool valid;
+  };
 
-void WriteAscii(PixelWriter& writer, Vector2D<int> base, char c, const PixelColor& color) {
-  const uint8_t* font = GetFont(c);
+  // フォントごとのキャッシュ
+  const int kGlyphCacheSize = 128;
+  template <typename FontT>
+  CachedGlyph<FontT> glyph_cache[kGlyphCacheSize];
+  GlyphCacheStatistics glyph_cache_stats{};
+
+  template <typename FontT>
+  const CachedGlyph<FontT>& GetGlyph(const FontGlyph<FontT::kHeight>& glyph, PixelFormat format,
+                                     uint32_t fg, uint32_t bg, bool opaque) {
+    const int W = FontT::kWidth, H = FontT::kHeight;
+    if(!opaque) {
+      bg = 0;
+    }
+
+    const auto index = reinterpret_cast<uintptr_t>(&glyph) / sizeof(glyph);
+    const auto hash = (index * 31u + fg * 17u + bg * 7u + format) % kGlyphCacheSize;
+    auto& cached = glyph_cache<FontT>[hash];
+    if(cached.valid && cached.glyph == &glyph && cached.format == format &&
+       cached.fg == fg && cached.bg == bg && cached.opaque == opaque) {
+      glyph_cache_stats.hits++;
+      return cached;
+    }
+
+    glyph_cache_stats.misses++;
+    for(int y = 0; y < H; y++) {
+      for(int x = 0; x < W; x++) {
+        cached.pixels[y][x] = ((glyph.rows[y] >> (W - 1 - x)) & 1) ? fg : bg;
+      }
+    }
+    cached.glyph = &glyph;
+    cached.fg = fg;
+    cached.bg = bg;
+    cached.format = format;
+    cached.opaque = opaque;
+    cached.valid = true;
+    return cached;
+  }
+
+  // 描画先のメモリに直接、8画素ずつ 16 バイト単位で書き込む。透過なら空の行は飛ばす
+  template <typename FontT>
+  void WriteGlyphNative(uint32_t* dst, int stride, const CachedGlyph<FontT>& cached) {
+    static_assert(FontT::kWidth % 8 == 0, "glyph width must be a multiple of 8");
+    const int W = FontT::kWidth, H = FontT::kHeight;
+    const auto& glyph = *cached.glyph;
+    const int first_row = cached.opaque ? 0 : glyph.first_row;
+    const int last_row = cached.opaque ? H : glyph.last_row;
+
+    dst += stride * first_row;
+    for(int y = first_row; y < last_row; y++, dst += stride) {
+      for(int k = 0; k < W / 8; k++) {
+        const auto src = reinterpret_cast<const __m128i*>(&cached.pixels[y][8 * k]);
+        auto d = reinterpret_cast<__m128i*>(dst + 8 * k);
+        const uint8_t bits = glyph.rows[y] >> (W - 8 * (k + 1));
+        if(cached.opaque || bits == 0xFF) {
+          _mm_storeu_si128(d, _mm_load_si128(src));
+          _mm_storeu_si128(d + 1, _mm_load_si128(src + 1));
+          continue;
+        }
+        if(bits == 0) {
+          continue;
+        }
 
-  for(int dy = 0; dy < 16; dy++) {
-    for(int dx = 0; dx < 8; dx++) {
-      if((font[dy] << dx) & 0x80) {
-        auto pos = Vector2D<int>{dx, dy};
-        writer.Write(base + pos, color);
+        const auto mask = reinterpret_cast<const __m128i*>(pixel_masks[bits]);
+        const auto m0 = _mm_load_si128(mask);
+        const auto m1 = _mm_load_si128(mask + 1);
+        _mm_storeu_si128(d, _mm_or_si128(_mm_andnot_si128(m0, _mm_loadu_si128(d)), _mm_load_si128(src)));
+        _mm_storeu_si128(d + 1, _mm_or_si128(_mm_andnot_si128(m1, _mm_loadu_si128(d + 1)), _mm_load_si128(src + 1)));
       }
     }
   }
+
+  // 描画先のメモリに直接書けない場合は、生成済みの範囲をそのまま塗る
+  template <typename FontT>
+  void WriteGlyphSpans(const FontT& font, PixelWriter& writer, Vector2D<int> base,
+                       const FontGlyph<FontT::kHeight>& glyph, const PixelColor& color, const PixelColor* bg) {
+    if(bg) {
+      writer.FillRect({base, {FontT::kWidth, FontT::kHeight}}, *bg);
+    }
+    for(int i = glyph.span_begin; i < glyph.span_end; i++) {
+      const auto& span = font.spans[i];
+      writer.FillSpan({base.x + span.x, base.y + span.y}, span.length, color);
+    }
+  }
 }
 
-void WriteString(PixelWriter& writer, Vector2D<int> pos, const char* s, const PixelColor& color) {
+// 文字列をまとめて描く。描画先に完全に収まる文字はキャッシュした画素を直接書き込む
+template <typename FontT>
+void WriteString(const FontT& font, PixelWriter& writer, Vector2D<int> pos, const char* s,
+                 const PixelColor& color, const PixelColor* bg) {
+  const int W = FontT::kWidth, H = FontT::kHeight;
+  PixelFormat format;
+  int stride = 0;
+  uint32_t* dst = nullptr;
+  int native_chars = 0;
+  if(pos.x >= 0 && pos.y >= 0 && pos.y + H <= writer.Height()) {
+    dst = writer.NativePixelAt(pos, format, stride);
+    native_chars = (writer.Width() - pos.x) / W;
+  }
+
+  uint32_t fg_pixel = 0, bg_pixel = 0;
+  if(dst) {
+    if(!pixel_masks_ready) {
+      InitializePixelMasks();
+    }
+    fg_pixel = EncodePixel(format, color);
+    bg_pixel = bg ? EncodePixel(format, *bg) : 0;
+  }
+
   for(int i = 0; s[i] != '\0'; i++) {
-    auto base = Vector2D<int> { pos.x + i * 8, pos.y };
-    WriteAscii(writer, base, s[i], color);
+    const auto& glyph = font.Glyph(s[i]);
+    if(i < native_chars && dst) {
+      // キャッシュは全タスクで共有するので、引いて手元に写すあいだだけ割り込みを止める。
+      // 描画先への書き込みは写しから行う
+      CachedGlyph<FontT> cached;
+      {
+        InterruptGuard guard;
+        cached = GetGlyph<FontT>(glyph, format, fg_pixel, bg_pixel, bg != nullptr);
+      }
+      WriteGlyphNative<FontT>(dst + i * W, stride, cached);
+    } else {
+      WriteGlyphSpans(font, writer, {pos.x + i * W, pos.y}, glyph, color, bg);
+    }
   }
+}
+
+template void WriteString(const decltype(kHankakuFont)& font, PixelWriter& writer, Vector2D<int> pos,
+                          const char* s, const PixelColor& color, const PixelColor* bg);
+
+void WriteAscii(PixelWriter& writer, Vector2D<int> base, char c, const PixelColor& color) {
+  const char s[2] = {c, '\0'};
+  WriteString(kHankakuFont, writer, base, s, color, nullptr);
+}
+
+void WriteAscii(PixelWriter& writer, Vector2D<int> base, char c, const PixelColor& color, const PixelColor& bg) {
+  const char s[2] = {c, '\0'};
+  WriteString(kHankakuFont, writer, base, s, color, &bg);
+}
+
+void WriteString(PixelWriter& writer, Vector2D<int> pos, const char* s, const PixelColor& color) {
+  WriteString(kHankakuFont, writer, pos, s, color, nullptr);
+}
+
+void WriteString(PixelWriter& writer, Vector2D<int> pos, const char* s, const PixelColor& color, const PixelColor& bg) {
+  WriteString(kHankakuFont, writer, pos, s, color, &bg);
+}
+
+GlyphCacheStatistics GetGlyphCacheStatistics() {
+  return glyph_cache_stats;
 }
\ No newline at end of file
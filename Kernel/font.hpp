@@ -3,5 +3,48 @@
 #include <cstdint>
 #include "graphics.hpp"
 
+// グリフの1行のうち、塗る画素が連続する範囲
+struct FontSpan {
+  uint8_t y, x, length;
+};
+
+template <int H>
+struct FontGlyph {
+  uint32_t rows[H];     // 各行のビット。上位ビットが左の画素
+  uint8_t first_row;    // 塗る画素のある行の範囲 [first_row, last_row)
+  uint8_t last_row;
+  uint16_t span_begin;  // Font::spans のうち、このグリフの範囲 [span_begin, span_end)
+  uint16_t span_end;
+};
+
+// tools/makefont.py がフォントファイルから生成する表。幅 W 高さ H のグリフ N 個と、その行内の範囲 S 個からなる
+template <int W, int H, int N, int S>
+struct Font {
+  static constexpr int kWidth = W;
+  static constexpr int kHeight = H;
+
+  FontGlyph<H> glyphs[N];
+  FontSpan spans[S];
+
+  constexpr const FontGlyph<H>& Glyph(char c) const {
+    const auto i = static_cast<uint8_t>(c);
+    return glyphs[i < N ? i : 0];
+  }
+};
+
 void WriteAscii(PixelWriter& writer, Vector2D<int> base, char c, const PixelColor& color);
-void WriteString(PixelWriter& writer, Vector2D<int> pos, const char* s, const PixelColor& color);
\ No newline at end of file
+// 背景色で塗りつぶしてから文字を描く
+void WriteAscii(PixelWriter& writer, Vector2D<int> base, char c, const PixelColor& color, const PixelColor& bg);
+void WriteString(PixelWriter& writer, Vector2D<int> pos, const char* s, const PixelColor& color);
+void WriteString(PixelWriter& writer, Vector2D<int> pos, const char* s, const PixelColor& color, const PixelColor& bg);
+
+// 指定したフォントで描く。bg が nullptr なら背景は透過する。
+// 使うフォントごとに font.cpp で明示的に実体化する
+template <typename FontT>
+void WriteString(const FontT& font, PixelWriter& writer, Vector2D<int> pos, const char* s,
+                 const PixelColor& color, const PixelColor* bg);
+
+struct GlyphCacheStatistics {
+  uint64_t hits, misses;
+};
+GlyphCacheStatistics GetGlyphCacheStatistics();
\ No newline at end of file
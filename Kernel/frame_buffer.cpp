@@ -1,33 +1,70 @@
+#include <emmintrin.h>
+
 #include "error.hpp"
 #include "frame_buffer.hpp"
 #include "frame_buffer_config.hpp"
 
 namespace {
-  int BytesPerPixel(PixelFormat format) {
-    auto bits = BitsPerPixel(format);
-    if(bits < 0) {
-      return -1;
-    }
-    
-    return (bits + 7) / 8;
+  // RGB と BGR の並びを入れ替える（1番目と3番目のバイトを交換する）
+  inline uint32_t SwapRedBlue(uint32_t v) {
+    return (v & 0xFF00FF00) | ((v >> 16) & 0xFF) | ((v & 0xFF) << 16);
   }
 
-  uint8_t* FrameAddrAt(Vector2D<int> pos, const FrameBufferConfig& config) {
-    auto bytes = BytesPerPixel(config.pixel_format);
-    if(bytes < 0) {
-      return nullptr;
+  inline __m128i SwapRedBlue(__m128i v) {
+    const auto keep = _mm_and_si128(v, _mm_set1_epi32(0xFF00FF00));
+    const auto c0 = _mm_and_si128(_mm_srli_epi32(v, 16), _mm_set1_epi32(0xFF));
+    const auto c2 = _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xFF)), 16);
+    return _mm_or_si128(keep, _mm_or_si128(c0, c2));
+  }
+
+  // 1行分の 32 ビット画素をコピーする。stream なら dst をキャッシュに載せない書き込みを使う
+  template <bool swap, bool stream>
+  void CopyScanline(uint32_t* dst, const uint32_t* src, int n) {
+    if constexpr (!swap && !stream) {
+      memcpy(dst, src, 4 * n);
+      return;
+    }
+
+    int i = 0;
+    // 非テンポラルストアは 16 バイト境界に揃える
+    for(; i < n && (reinterpret_cast<uintptr_t>(dst + i) & 15) != 0; i++) {
+      dst[i] = swap ? SwapRedBlue(src[i]) : src[i];
+    }
+
+    for(; i + 4 <= n; i += 4) {
+      _mm_prefetch(reinterpret_cast<const char*>(src + i) + 256, _MM_HINT_NTA);
+      auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+      if constexpr (swap) {
+        v = SwapRedBlue(v);
+      }
+      auto d = reinterpret_cast<__m128i*>(dst + i);
+      if constexpr (stream) {
+        _mm_stream_si128(d, v);
+      } else {
+        _mm_store_si128(d, v);
+      }
     }
 
-    return config.frame_buffer + bytes * (config.pixels_per_scanline * pos.y + pos.x);
+    for(; i < n; i++) {
+      dst[i] = swap ? SwapRedBlue(src[i]) : src[i];
+    }
   }
 
-  int BytesPerScanLine(const FrameBufferConfig& config) {
-    auto bytes = BytesPerPixel(config.pixel_format);
-    if(bytes < 0) {
-      return -1;
+  // 32 ビット形式 Src の1行を形式 Dst に変換する。32 ビットどうしなら違いは R と B の並びだけ
+  template <PixelFormat Dst, PixelFormat Src, bool stream>
+  void ConvertScanline(uint8_t* dst, const uint32_t* src, int n) {
+    if constexpr (BytesPerPixelOf<Dst>() == 4) {
+      CopyScanline<Dst != Src, stream>(reinterpret_cast<uint32_t*>(dst), src, n);
+    } else {
+      for(int i = 0; i < n; i++) {
+        StorePixel<Dst>(dst + BytesPerPixelOf<Dst>() * i, EncodeColor<Dst>(DecodeColor<Src>(src[i])));
+      }
     }
+  }
 
-    return bytes * config.pixels_per_scanline;
+  template <PixelFormat Dst, PixelFormat Src>
+  auto SelectConverter(bool stream) {
+    return stream ? ConvertScanline<Dst, Src, true> : ConvertScanline<Dst, Src, false>;
   }
 
   Vector2D<int> FrameBufferSize(const FrameBufferConfig& config) {
@@ -38,7 +75,7 @@ namespace {
   }
 }
 
-Error FrameBuffer::Initialize(const FrameBufferConfig& config) {
+Error FrameBuffer::Initialize(const FrameBufferConfig& config, size_t buffer_alignment) {
   config_ = config;
 
   const auto bits_per_pixel = BitsPerPixel(config_.pixel_format);
@@ -46,20 +83,34 @@ Error FrameBuffer::Initialize(const FrameBufferConfig& config) {
     return MAKE_ERROR(Error::kUnknownPixelFormat);
   }
 
+  bytes_per_pixel_ = (bits_per_pixel + 7) / 8;
   if(config_.frame_buffer) {
     buffer_.resize(0);
   } else {
-    buffer_.resize(((bits_per_pixel + 7) / 8) * config_.horizontal_resolution * config_.vertical_resolution);
-    config_.frame_buffer = buffer_.data();  
-    config_.pixels_per_scanline = config_.horizontal_resolution;
+    // 行ごとに SIMD やキャッシュラインの境界から始まるよう、1行の長さを切り上げる
+    const int pixels_per_align = kScanlineAlignment / bytes_per_pixel_;
+    config_.pixels_per_scanline =
+      (config_.horizontal_resolution + pixels_per_align - 1) / pixels_per_align * pixels_per_align;
+    const size_t bytes = bytes_per_pixel_ * config_.pixels_per_scanline * config_.vertical_resolution;
+    buffer_.resize((bytes + buffer_alignment - 1) / buffer_alignment * buffer_alignment
+                   + buffer_alignment);
+    const auto addr = reinterpret_cast<uintptr_t>(buffer_.data());
+    config_.frame_buffer = reinterpret_cast<uint8_t*>(
+      (addr + buffer_alignment - 1) & ~static_cast<uintptr_t>(buffer_alignment - 1));
   }
 
   switch(config_.pixel_format) {
     case kPixelRGBResv8BitPerColor:
-      writer_ = std::make_unique<RGBResv8BitPerColorPixelWriter>(config_);
+      SetupFormat<kPixelRGBResv8BitPerColor>();
       break;
     case kPixelBGRResv8BitPerColor:
-      writer_ = std::make_unique<BGRResv8BitPerColorPixelWriter>(config_);
+      SetupFormat<kPixelBGRResv8BitPerColor>();
+      break;
+    case kPixelRGB565:
+      SetupFormat<kPixelRGB565>();
+      break;
+    case kPixelBGR8BitPerColor:
+      SetupFormat<kPixelBGR8BitPerColor>();
       break;
     default:
       return MAKE_ERROR(Error::kUnknownPixelFormat);
@@ -68,15 +119,22 @@ Error FrameBuffer::Initialize(const FrameBufferConfig& config) {
   return MAKE_ERROR(Error::kSuccess);
 }
 
-Error FrameBuffer::Copy(Vector2D<int> dst_pos, const FrameBuffer& src, Rectangle<int> src_area) {
-  if(config_.pixel_format != src.config_.pixel_format) {
-    return MAKE_ERROR(Error::kUnknownPixelFormat);
-  }
+template <PixelFormat F>
+void FrameBuffer::SetupFormat() {
+  writer_ = std::make_unique<FormatPixelWriter<F>>(config_);
+  // 実際の画面に書いた内容は読み返さないので、キャッシュを汚さないよう非テンポラルストアで書く
+  const bool stream = IsScanout();
+  converters_[kPixelRGBResv8BitPerColor] = SelectConverter<F, kPixelRGBResv8BitPerColor>(stream);
+  converters_[kPixelBGRResv8BitPerColor] = SelectConverter<F, kPixelBGRResv8BitPerColor>(stream);
+}
 
-  const auto bits_per_pixel = BitsPerPixel(config_.pixel_format);
-  if(bits_per_pixel <= 0) {
+Error FrameBuffer::Copy(Vector2D<int> dst_pos, const FrameBuffer& src, Rectangle<int> src_area) {
+  // 転送元はウィンドウや合成用の 32 ビットのバッファ
+  const auto src_format = src.config_.pixel_format;
+  if(src_format != kPixelRGBResv8BitPerColor && src_format != kPixelBGRResv8BitPerColor) {
     return MAKE_ERROR(Error::kUnknownPixelFormat);
   }
+  const auto convert = converters_[src_format];
 
   const Rectangle<int> src_area_shifted{dst_pos, src_area.size};
   const Rectangle<int> src_outline{dst_pos - src_area.pos, FrameBufferSize(src.config_)};
@@ -84,26 +142,28 @@ Error FrameBuffer::Copy(Vector2D<int> dst_pos, const FrameBuffer& src, Rectangle
   const auto copy_area = dst_outline & src_outline & src_area_shifted;  
   const auto src_start_pos = copy_area.pos - (dst_pos - src_area.pos);
 
-  uint8_t* dst_buf = FrameAddrAt(copy_area.pos, config_);
-  const uint8_t* src_buf = FrameAddrAt(src_start_pos, src.config_);  
+  uint8_t* dst_buf = PixelAt(copy_area.pos);
+  const uint8_t* src_buf = src.PixelAt(src_start_pos);  
   
-  auto bytes_per_pixel = BytesPerPixel(config_.pixel_format);
   for(int dy = 0; dy < copy_area.size.y; dy++) {
-    memcpy(dst_buf, src_buf, bytes_per_pixel * copy_area.size.x);
-    dst_buf += bytes_per_pixel * config_.pixels_per_scanline;
-    src_buf += bytes_per_pixel * src.config_.pixels_per_scanline;
+    convert(dst_buf, reinterpret_cast<const uint32_t*>(src_buf), copy_area.size.x);
+    dst_buf += BytesPerScanLine();
+    src_buf += src.BytesPerScanLine();
+  }
+  if(IsScanout()) {
+    _mm_sfence();
   }
 
   return MAKE_ERROR(Error::kSuccess);
 }
 
 void FrameBuffer::Move(Vector2D<int> dst_pos, const Rectangle<int>& src) {
-  const auto bytes_per_pixel = BytesPerPixel(config_.pixel_format);
-  const auto bytes_per_scanline = BytesPerScanLine(config_);
+  const auto bytes_per_pixel = bytes_per_pixel_;
+  const auto bytes_per_scanline = BytesPerScanLine();
 
   if(dst_pos.y < src.pos.y) {
-    uint8_t* dst_buf = FrameAddrAt(dst_pos, config_);
-    const uint8_t* src_buf = FrameAddrAt(src.pos, config_);
+    uint8_t* dst_buf = PixelAt(dst_pos);
+    const uint8_t* src_buf = PixelAt(src.pos);
 
     for(int y = 0; y < src.size.y; y++) {
       memcpy(dst_buf, src_buf, bytes_per_pixel * src.size.x);
@@ -111,8 +171,8 @@ void FrameBuffer::Move(Vector2D<int> dst_pos, const Rectangle<int>& src) {
       src_buf += bytes_per_scanline;
     }
   } else {
-    uint8_t* dst_buf = FrameAddrAt(dst_pos + Vector2D<int>{0, src.size.y - 1}, config_);
-    const uint8_t* src_buf = FrameAddrAt(src.pos + Vector2D<int>{0, src.size.y - 1}, config_);
+    uint8_t* dst_buf = PixelAt(dst_pos + Vector2D<int>{0, src.size.y - 1});
+    const uint8_t* src_buf = PixelAt(src.pos + Vector2D<int>{0, src.size.y - 1});
 
     for (int y = 0; y < src.size.y; y++) {
       memcpy(dst_buf, src_buf, bytes_per_pixel * src.size.x);
@@ -122,15 +182,59 @@ void FrameBuffer::Move(Vector2D<int> dst_pos, const Rectangle<int>& src) {
   }
 }
 
-FrameBufferConfig FrameBuffer::Config() {
+FrameBufferConfig FrameBuffer::Config() const {
   return config_;
 }
 
+uint8_t* FrameBuffer::PixelAt(Vector2D<int> pos) {
+  return config_.frame_buffer + bytes_per_pixel_ * (config_.pixels_per_scanline * pos.y + pos.x);
+}
+
+const uint8_t* FrameBuffer::PixelAt(Vector2D<int> pos) const {
+  return config_.frame_buffer + bytes_per_pixel_ * (config_.pixels_per_scanline * pos.y + pos.x);
+}
+
+int FrameBuffer::BytesPerScanLine() const {
+  return bytes_per_pixel_ * config_.pixels_per_scanline;
+}
+
 int BitsPerPixel(PixelFormat format) {
   switch(format) {
     case kPixelRGBResv8BitPerColor: return 32;
     case kPixelBGRResv8BitPerColor: return 32;
+    case kPixelRGB565: return 16;
+    case kPixelBGR8BitPerColor: return 24;
   }
 
   return -1;
+}
+
+uint32_t EncodePixel(PixelFormat format, const PixelColor& c) {
+  switch(format) {
+    case kPixelRGBResv8BitPerColor:
+      return EncodeColor<kPixelRGBResv8BitPerColor>(c);
+    case kPixelBGRResv8BitPerColor:
+      return EncodeColor<kPixelBGRResv8BitPerColor>(c);
+    case kPixelRGB565:
+      return EncodeColor<kPixelRGB565>(c);
+    case kPixelBGR8BitPerColor:
+      return EncodeColor<kPixelBGR8BitPerColor>(c);
+  }
+
+  return 0;
+}
+
+PixelColor DecodePixel(PixelFormat format, uint32_t v) {
+  switch(format) {
+    case kPixelRGBResv8BitPerColor:
+      return DecodeColor<kPixelRGBResv8BitPerColor>(v);
+    case kPixelBGRResv8BitPerColor:
+      return DecodeColor<kPixelBGRResv8BitPerColor>(v);
+    case kPixelRGB565:
+      return DecodeColor<kPixelRGB565>(v);
+    case kPixelBGR8BitPerColor:
+      return DecodeColor<kPixelBGR8BitPerColor>(v);
+  }
+
+  return {0, 0, 0};
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <vector>
 #include <memory>
 
@@ -9,17 +10,43 @@
 
 class FrameBuffer {
   public:
-    Error Initialize(const FrameBufferConfig& config);
+    // 自前でバッファを確保するとき、先頭と各行の先頭をこの境界に揃える
+    static const int kScanlineAlignment = 64;
+
+    // 自前で確保するときは先頭を buffer_alignment に揃え、確保する大きさもその倍数にする
+    Error Initialize(const FrameBufferConfig& config, size_t buffer_alignment = kScanlineAlignment);
     Error Copy(Vector2D<int> pos, const FrameBuffer& src, Rectangle<int> area);
     void Move(Vector2D<int> dst_pos, const Rectangle<int>& src);
-    FrameBufferConfig Config();
+    FrameBufferConfig Config() const;
     
     FrameBufferWriter& Writer() { return *writer_; }
+    uint8_t* PixelAt(Vector2D<int> pos);
+    const uint8_t* PixelAt(Vector2D<int> pos) const;
+    int BytesPerScanLine() const;
+    // 自前で確保したバッファのバイト数
+    size_t BufferBytes() const { return buffer_.size(); }
+    // 外から与えられたメモリ（GOP のフレームバッファ）に描くなら true
+    bool IsScanout() const { return buffer_.empty(); }
 
   private:
+    // 32 ビット形式の src の1行 n 画素を、この FrameBuffer の形式に変換して dst に書く
+    using ScanlineConverter = void (*)(uint8_t* dst, const uint32_t* src, int n);
+
+    // ピクセル形式に合わせた書き込み器と変換関数を選ぶ
+    template <PixelFormat F>
+    void SetupFormat();
+
     FrameBufferConfig config_{};
+    int bytes_per_pixel_{0};
     std::vector<uint8_t> buffer_{};
     std::unique_ptr<FrameBufferWriter> writer_{};    
+    // 転送元の形式 (kPixelRGBResv8BitPerColor / kPixelBGRResv8BitPerColor) ごとの変換関数
+    std::array<ScanlineConverter, 2> converters_{};
 };
 
-int BitsPerPixel(PixelFormat format);
\ No newline at end of file
+int BitsPerPixel(PixelFormat format);
+// 色をピクセル形式ごとのメモリ上の表現（リトルエンディアン）に変換する
+uint32_t EncodePixel(PixelFormat format, const PixelColor& c);
+PixelColor DecodePixel(PixelFormat format, uint32_t v);
+// 予約バイトを除いた、色を表すビット
+const uint32_t kPixelColorMask = 0x00FFFFFF;
\ No newline at end of file
@@ -5,6 +5,8 @@
 enum PixelFormat {
   kPixelRGBResv8BitPerColor,
   kPixelBGRResv8BitPerColor,
+  kPixelRGB565,           // 16 ビット。上位から R 5 ビット、G 6 ビット、B 5 ビット
+  kPixelBGR8BitPerColor,  // 24 ビット。メモリ上は B, G, R の順
 };
 
 struct FrameBufferConfig {
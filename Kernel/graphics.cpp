@@ -1,36 +1,256 @@
+#include <cstdlib>
+#include <emmintrin.h>
+
 #include "graphics.hpp"
 
-void RGBResv8BitPerColorPixelWriter::Write(Vector2D<int> pos, const PixelColor& color)  {
-  auto p = PixelAt(pos.x, pos.y);
-  p[0] = color.r;
-  p[1] = color.g;
-  p[2] = color.b;
+void FillPixels32(uint32_t* dst, int n, uint32_t v) {
+  int i = 0;
+  for(; i < n && (reinterpret_cast<uintptr_t>(dst + i) & 15) != 0; i++) {
+    dst[i] = v;
+  }
+
+  const __m128i v4 = _mm_set1_epi32(v);
+  for(; i + 4 <= n; i += 4) {
+    _mm_store_si128(reinterpret_cast<__m128i*>(dst + i), v4);
+  }
+
+  for(; i < n; i++) {
+    dst[i] = v;
+  }
 }
 
-void BGRResv8BitPerColorPixelWriter::Write(Vector2D<int> pos, const PixelColor& color) {
-  auto p = PixelAt(pos.x, pos.y);
-  p[0] = color.b;
-  p[1] = color.g;
-  p[2] = color.r;
+void CopyPixels32(uint32_t* dst, const uint32_t* src, int n) {
+  int i = 0;
+  for(; i + 4 <= n; i += 4) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+  }
+
+  for(; i < n; i++) {
+    dst[i] = src[i];
+  }
 }
 
-void DrawRectangle(PixelWriter& writer, const Vector2D<int>& pos, const Vector2D<int>& size, const PixelColor& color) {
-  for(int x = 0; x < size.x; x++) {
-    
-    writer.Write(pos + Vector2D<int>{x, 0}         , color);
-    writer.Write(pos + Vector2D<int>{x, size.y - 1}, color);    
+namespace {
+  // 16 ビットの各要素 x (0 <= x <= 255 * 255) を 255 で割って丸める
+  __m128i Div255(__m128i x) {
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+  }
+
+  // 16 ビットに広げた2画素分を合成する
+  __m128i BlendHalf(__m128i s, __m128i d) {
+    // 各画素の透明度を、その画素の4要素すべてに広げる
+    const auto t = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0xFF), 0xFF);
+    const auto a = _mm_sub_epi16(_mm_set1_epi16(255), t);
+    return Div255(_mm_add_epi16(_mm_mullo_epi16(s, a), _mm_mullo_epi16(d, t)));
+  }
+
+  uint32_t BlendPixel(uint32_t s, uint32_t d) {
+    const uint32_t t = s >> 24, a = 255 - t;
+    uint32_t result = 0;
+    for(int shift = 0; shift < 24; shift += 8) {
+      const uint32_t x = ((s >> shift) & 0xFF) * a + ((d >> shift) & 0xFF) * t + 128;
+      result |= (((x + (x >> 8)) >> 8) & 0xFF) << shift;
+    }
+    return result;
+  }
+}
+
+void BlendPixels32(uint32_t* dst, const uint32_t* src, int n) {
+  const auto zero = _mm_setzero_si128();
+  const auto color_mask = _mm_set1_epi32(0x00FFFFFF);
+  int i = 0;
+  for(; i + 4 <= n; i += 4) {
+    const auto s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const auto t = _mm_srli_epi32(s, 24);
+    const auto opaque = _mm_movemask_epi8(_mm_cmpeq_epi32(t, zero));
+    if(opaque == 0xFFFF) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_and_si128(s, color_mask));
+      continue;
+    }
+    if(_mm_movemask_epi8(_mm_cmpeq_epi32(t, _mm_set1_epi32(255))) == 0xFFFF) {
+      continue;
+    }
+
+    auto dp = reinterpret_cast<__m128i*>(dst + i);
+    const auto d = _mm_loadu_si128(dp);
+    const auto lo = BlendHalf(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero));
+    const auto hi = BlendHalf(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero));
+    _mm_storeu_si128(dp, _mm_and_si128(_mm_packus_epi16(lo, hi), color_mask));
+  }
+
+  for(; i < n; i++) {
+    dst[i] = BlendPixel(src[i], dst[i]);
+  }
+}
+
+void PixelWriter::FillSpan(Vector2D<int> pos, int length, const PixelColor& c) {
+  for(int x = 0; x < length; x++) {
+    Write(pos + Vector2D<int>{x, 0}, c);
+  }
+}
+
+void PixelWriter::FillRect(const Rectangle<int>& rect, const PixelColor& c) {
+  for(int y = 0; y < rect.size.y; y++) {
+    FillSpan(rect.pos + Vector2D<int>{0, y}, rect.size.x, c);
   }
+}
 
+void PixelWriter::BlitRect(Vector2D<int> pos, const PixelColor* src, Vector2D<int> size, int src_stride) {
   for(int y = 0; y < size.y; y++) {
-    writer.Write(pos + Vector2D<int>{        0, y}, color);
-    writer.Write(pos + Vector2D<int>{size.x -1, y}, color);    
+    for(int x = 0; x < size.x; x++) {
+      Write(pos + Vector2D<int>{x, y}, src[src_stride * y + x]);
+    }
   }
 }
 
-void FillRectangle(PixelWriter& writer, const Vector2D<int>& pos, const Vector2D<int>& size, const PixelColor& color) {
+void PixelWriter::MaskedFill(Vector2D<int> pos, const uint8_t* mask, Vector2D<int> size, const PixelColor& c) {
+  const int bytes_per_row = (size.x + 7) / 8;
   for(int y = 0; y < size.y; y++) {
     for(int x = 0; x < size.x; x++) {
-      writer.Write(pos + Vector2D<int>{x, y}, color);      
+      if((mask[bytes_per_row * y + x / 8] << (x % 8)) & 0x80) {
+        Write(pos + Vector2D<int>{x, y}, c);
+      }
+    }
+  }
+}
+
+template <PixelFormat F>
+void FormatPixelWriter<F>::FillRow(uint8_t* p, int n, uint32_t v) {
+  if constexpr (kBytesPerPixel == 4) {
+    FillPixels32(reinterpret_cast<uint32_t*>(p), n, v);
+  } else if constexpr (kBytesPerPixel == 2) {
+    auto row = reinterpret_cast<uint16_t*>(p);
+    for(int x = 0; x < n; x++) {
+      row[x] = v;
+    }
+  } else {
+    for(int x = 0; x < n; x++) {
+      StorePixel<F>(p + kBytesPerPixel * x, v);
+    }
+  }
+}
+
+template <PixelFormat F>
+void FormatPixelWriter<F>::Write(Vector2D<int> pos, const PixelColor& c) {
+  StorePixel<F>(PixelAt(pos.x, pos.y), EncodeColor<F>(c));
+}
+
+template <PixelFormat F>
+void FormatPixelWriter<F>::FillSpan(Vector2D<int> pos, int length, const PixelColor& c) {
+  FillRect({pos, {length, 1}}, c);
+}
+
+template <PixelFormat F>
+void FormatPixelWriter<F>::FillRect(const Rectangle<int>& rect, const PixelColor& c) {
+  const auto area = Clip(rect);
+  if(IsEmpty(area)) {
+    return;
+  }
+
+  const auto v = EncodeColor<F>(c);
+  for(int y = 0; y < area.size.y; y++) {
+    FillRow(PixelAt(area.pos.x, area.pos.y + y), area.size.x, v);
+  }
+}
+
+template <PixelFormat F>
+void FormatPixelWriter<F>::BlitRect(Vector2D<int> pos, const PixelColor* src,
+                                    Vector2D<int> size, int src_stride) {
+  const auto area = Clip({pos, size});
+  if(IsEmpty(area)) {
+    return;
+  }
+
+  const auto offset = area.pos - pos;
+  src += src_stride * offset.y + offset.x;
+  for(int y = 0; y < area.size.y; y++) {
+    auto row = PixelAt(area.pos.x, area.pos.y + y);
+    for(int x = 0; x < area.size.x; x++) {
+      StorePixel<F>(row + kBytesPerPixel * x, EncodeColor<F>(src[x]));
+    }
+    src += src_stride;
+  }
+}
+
+template <PixelFormat F>
+void FormatPixelWriter<F>::MaskedFill(Vector2D<int> pos, const uint8_t* mask,
+                                      Vector2D<int> size, const PixelColor& c) {
+  const auto area = Clip({pos, size});
+  if(IsEmpty(area)) {
+    return;
+  }
+
+  const int bytes_per_row = (size.x + 7) / 8;
+  const auto offset = area.pos - pos;
+  const auto v = EncodeColor<F>(c);
+  for(int y = 0; y < area.size.y; y++) {
+    const uint8_t* m = mask + bytes_per_row * (offset.y + y);
+    auto row = PixelAt(pos.x, area.pos.y + y);
+    for(int x = offset.x; x < offset.x + area.size.x; x++) {
+      const uint8_t bits = m[x / 8];
+      if(bits == 0) {
+        x |= 7;  // このバイトには塗る画素がない
+        continue;
+      }
+      if((bits << (x % 8)) & 0x80) {
+        StorePixel<F>(row + kBytesPerPixel * x, v);
+      }
+    }
+  }
+}
+
+template class FormatPixelWriter<kPixelRGBResv8BitPerColor>;
+template class FormatPixelWriter<kPixelBGRResv8BitPerColor>;
+template class FormatPixelWriter<kPixelRGB565>;
+template class FormatPixelWriter<kPixelBGR8BitPerColor>;
+
+void DrawRectangle(PixelWriter& writer, const Vector2D<int>& pos, const Vector2D<int>& size, const PixelColor& color) {
+  writer.FillSpan(pos, size.x, color);
+  writer.FillSpan(pos + Vector2D<int>{0, size.y - 1}, size.x, color);
+  writer.FillRect({pos, {1, size.y}}, color);
+  writer.FillRect({pos + Vector2D<int>{size.x - 1, 0}, {1, size.y}}, color);
+}
+
+void FillRectangle(PixelWriter& writer, const Vector2D<int>& pos, const Vector2D<int>& size, const PixelColor& color) {
+  writer.FillRect({pos, size}, color);
+}
+
+void DrawLine(PixelWriter& writer, Vector2D<int> p0, Vector2D<int> p1, const PixelColor& color) {
+  // 水平・垂直な線は塗りつぶしで済ませる
+  if(p0.y == p1.y) {
+    const int x = std::min(p0.x, p1.x);
+    writer.FillSpan({x, p0.y}, std::max(p0.x, p1.x) - x + 1, color);
+    return;
+  }
+  if(p0.x == p1.x) {
+    const int y = std::min(p0.y, p1.y);
+    writer.FillRect({{p0.x, y}, {1, std::max(p0.y, p1.y) - y + 1}}, color);
+    return;
+  }
+
+  // Bresenham。Write は範囲を確かめないので、描画先の外の点は飛ばす
+  const int width = writer.Width(), height = writer.Height();
+  const int dx = std::abs(p1.x - p0.x), dy = -std::abs(p1.y - p0.y);
+  const int sx = p0.x < p1.x ? 1 : -1, sy = p0.y < p1.y ? 1 : -1;
+  int err = dx + dy;
+  auto p = p0;
+  while(true) {
+    if(0 <= p.x && p.x < width && 0 <= p.y && p.y < height) {
+      writer.Write(p, color);
+    }
+    if(p.x == p1.x && p.y == p1.y) {
+      break;
+    }
+    const int e2 = 2 * err;
+    if(e2 >= dy) {
+      err += dy;
+      p.x += sx;
+    }
+    if(e2 <= dx) {
+      err += dx;
+      p.y += sy;
     }
   }
 }
@@ -58,6 +278,8 @@ void DrawDesktop(PixelWriter& writer) {
 
 namespace {
   char screen_writer_buf[sizeof(RGBResv8BitPerColorPixelWriter)];  
+  static_assert(sizeof(RGB565PixelWriter) == sizeof(RGBResv8BitPerColorPixelWriter));
+  static_assert(sizeof(BGR8BitPerColorPixelWriter) == sizeof(RGBResv8BitPerColorPixelWriter));
 }
 
 void InitializeGraphics(const FrameBufferConfig& config) {
@@ -66,9 +288,19 @@ void InitializeGraphics(const FrameBufferConfig& config) {
   switch(config.pixel_format) {
     case kPixelRGBResv8BitPerColor:
       screen_writer = new(screen_writer_buf) RGBResv8BitPerColorPixelWriter(config);
+      window_pixel_format = kPixelRGBResv8BitPerColor;
       break;
     case kPixelBGRResv8BitPerColor:
       screen_writer = new(screen_writer_buf) BGRResv8BitPerColorPixelWriter(config);
+      window_pixel_format = kPixelBGRResv8BitPerColor;
+      break;
+    case kPixelRGB565:
+      screen_writer = new(screen_writer_buf) RGB565PixelWriter(config);
+      window_pixel_format = kPixelBGRResv8BitPerColor;
+      break;
+    case kPixelBGR8BitPerColor:
+      screen_writer = new(screen_writer_buf) BGR8BitPerColorPixelWriter(config);
+      window_pixel_format = kPixelBGRResv8BitPerColor;
       break;
     default:
       exit(1);
@@ -5,13 +5,15 @@
 
 struct PixelColor {
   uint8_t r, g, b;  
+  uint8_t a = 255;  // 不透明度。アルファ合成するウィンドウでだけ意味を持つ
 };
 
 inline bool operator ==(const PixelColor& lhs, const PixelColor& rhs) {
   return (
     lhs.r == rhs.r &&
     lhs.g == rhs.g &&
-    lhs.b == rhs.b
+    lhs.b == rhs.b &&
+    lhs.a == rhs.a
   );
 }
 
@@ -84,14 +86,122 @@ Rectangle<T> operator&(const Rectangle<T>& lhs, const Rectangle<T>& rhs) {
   return {new_pos, new_size};
 }
 
+template <typename T>
+bool IsEmpty(const Rectangle<T>& rect) {
+  return rect.size.x <= 0 || rect.size.y <= 0;
+}
+
+// outer が inner を完全に含むか
+template <typename T>
+bool Contains(const Rectangle<T>& outer, const Rectangle<T>& inner) {
+  const auto outer_end = outer.pos + outer.size;
+  const auto inner_end = inner.pos + inner.size;
+  return outer.pos.x <= inner.pos.x && outer.pos.y <= inner.pos.y &&
+         inner_end.x <= outer_end.x && inner_end.y <= outer_end.y;
+}
+
+// lhs から rhs と重なる部分を除いた領域を、重ならない最大4つの矩形として out に書き出す
+template <typename T, typename OutputIt>
+OutputIt SubtractRectangle(const Rectangle<T>& lhs, const Rectangle<T>& rhs, OutputIt out) {
+  const auto overlap = lhs & rhs;
+  if(IsEmpty(overlap)) {
+    *out++ = lhs;
+    return out;
+  }
+
+  const auto lhs_end = lhs.pos + lhs.size;
+  const auto overlap_end = overlap.pos + overlap.size;
+  if(overlap.pos.y > lhs.pos.y) {
+    *out++ = Rectangle<T>{lhs.pos, {lhs.size.x, overlap.pos.y - lhs.pos.y}};
+  }
+  if(overlap_end.y < lhs_end.y) {
+    *out++ = Rectangle<T>{{lhs.pos.x, overlap_end.y}, {lhs.size.x, lhs_end.y - overlap_end.y}};
+  }
+  if(overlap.pos.x > lhs.pos.x) {
+    *out++ = Rectangle<T>{{lhs.pos.x, overlap.pos.y}, {overlap.pos.x - lhs.pos.x, overlap.size.y}};
+  }
+  if(overlap_end.x < lhs_end.x) {
+    *out++ = Rectangle<T>{{overlap_end.x, overlap.pos.y}, {lhs_end.x - overlap_end.x, overlap.size.y}};
+  }
+  return out;
+}
+
 class PixelWriter {
   public:    
     virtual ~PixelWriter() = default;
     virtual void Write(Vector2D<int> pos, const PixelColor& c) = 0;
     virtual int Width() const = 0;
     virtual int Height() const = 0;      
+
+    // まとめて描画する。既定の実装は Write を繰り返すので、実際の描画先で上書きする
+    virtual void FillSpan(Vector2D<int> pos, int length, const PixelColor& c);
+    virtual void FillRect(const Rectangle<int>& rect, const PixelColor& c);
+    // src の各行は src_stride 要素ごとに並ぶ
+    virtual void BlitRect(Vector2D<int> pos, const PixelColor* src, Vector2D<int> size, int src_stride);
+    // mask は1行 (size.x + 7) / 8 バイトの1ビット画像（上位ビットが左）で、立っているビットだけ c で塗る
+    virtual void MaskedFill(Vector2D<int> pos, const uint8_t* mask, Vector2D<int> size, const PixelColor& c);
+    // 描画先がメモリ上の 32 ビットピクセルなら、pos の画素のアドレスと形式、1行の画素数を返す。そうでなければ nullptr
+    virtual uint32_t* NativePixelAt(Vector2D<int> pos, PixelFormat& format, int& stride) { return nullptr; }
 };
 
+// 1画素のバイト数
+template <PixelFormat F>
+constexpr int BytesPerPixelOf() {
+  if constexpr (F == kPixelRGB565) {
+    return 2;
+  } else if constexpr (F == kPixelBGR8BitPerColor) {
+    return 3;
+  } else {
+    return 4;
+  }
+}
+
+// 色をピクセル形式ごとのメモリ上の表現（リトルエンディアン）に変換する。
+// 32 ビットの形式では予約バイトに透明度 (255 - a) を入れるので、不透明な色は予約バイトが 0 のままになる
+template <PixelFormat F>
+constexpr uint32_t EncodeColor(const PixelColor& c) {
+  if constexpr (F == kPixelRGBResv8BitPerColor) {
+    return c.r | (c.g << 8) | (c.b << 16) | static_cast<uint32_t>(255 - c.a) << 24;
+  } else if constexpr (F == kPixelBGRResv8BitPerColor) {
+    return c.b | (c.g << 8) | (c.r << 16) | static_cast<uint32_t>(255 - c.a) << 24;
+  } else if constexpr (F == kPixelRGB565) {
+    return (c.r >> 3) << 11 | (c.g >> 2) << 5 | (c.b >> 3);
+  } else {
+    return c.b | (c.g << 8) | (c.r << 16);
+  }
+}
+
+template <PixelFormat F>
+constexpr PixelColor DecodeColor(uint32_t v) {
+  if constexpr (F == kPixelRGB565) {
+    const uint8_t r = (v >> 11) & 0x1F, g = (v >> 5) & 0x3F, b = v & 0x1F;
+    return {static_cast<uint8_t>(r << 3 | r >> 2), static_cast<uint8_t>(g << 2 | g >> 4),
+            static_cast<uint8_t>(b << 3 | b >> 2)};
+  } else {
+    const uint8_t c0 = v & 0xFF, c1 = (v >> 8) & 0xFF, c2 = (v >> 16) & 0xFF;
+    const uint8_t a = BytesPerPixelOf<F>() == 4 ? 255 - (v >> 24) : 255;
+    if constexpr (F == kPixelRGBResv8BitPerColor) {
+      return {c0, c1, c2, a};
+    } else {
+      return {c2, c1, c0, a};
+    }
+  }
+}
+
+// メモリ上の表現 v を p に書く
+template <PixelFormat F>
+inline void StorePixel(uint8_t* p, uint32_t v) {
+  if constexpr (BytesPerPixelOf<F>() == 4) {
+    *reinterpret_cast<uint32_t*>(p) = v;
+  } else if constexpr (BytesPerPixelOf<F>() == 2) {
+    *reinterpret_cast<uint16_t*>(p) = v;
+  } else {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+  }
+}
+
 class FrameBufferWriter : public PixelWriter {
   public:
     FrameBufferWriter(const FrameBufferConfig& config) : config_{config} {}
@@ -100,28 +210,64 @@ class FrameBufferWriter : public PixelWriter {
     virtual int Height() const override { return config_.vertical_resolution; }
 
   protected:
-    uint8_t* PixelAt(int x, int y) {
-      return config_.frame_buffer + (config_.pixels_per_scanline * y + x) * 4;
+    uint8_t* Buffer() const { return config_.frame_buffer; }
+    int Stride() const { return config_.pixels_per_scanline; }
+    // 描画先の大きさで切り取る
+    Rectangle<int> Clip(const Rectangle<int>& rect) const {
+      return rect & Rectangle<int>{{0, 0}, {Width(), Height()}};
     }
 
   private:
     const FrameBufferConfig& config_;
 };
 
-class RGBResv8BitPerColorPixelWriter : public FrameBufferWriter {
+// ピクセル形式ごとの実装。画素の大きさや色の変換はテンプレート引数で決まるので、画素ごとに形式を調べることはない。
+// どの形式を使うかは FrameBuffer::Initialize と InitializeGraphics で1度だけ選ぶ
+template <PixelFormat F>
+class FormatPixelWriter : public FrameBufferWriter {
   public:
-    using FrameBufferWriter::FrameBufferWriter;
-    virtual void Write(Vector2D<int> pos, const PixelColor& c) override;    
-};
+    static constexpr int kBytesPerPixel = BytesPerPixelOf<F>();
 
-class BGRResv8BitPerColorPixelWriter : public FrameBufferWriter {
-  public:
     using FrameBufferWriter::FrameBufferWriter;
     virtual void Write(Vector2D<int> pos, const PixelColor& c) override;    
+    virtual void FillSpan(Vector2D<int> pos, int length, const PixelColor& c) override;
+    virtual void FillRect(const Rectangle<int>& rect, const PixelColor& c) override;
+    virtual void BlitRect(Vector2D<int> pos, const PixelColor* src, Vector2D<int> size, int src_stride) override;
+    virtual void MaskedFill(Vector2D<int> pos, const uint8_t* mask, Vector2D<int> size, const PixelColor& c) override;
+    virtual uint32_t* NativePixelAt(Vector2D<int> pos, PixelFormat& format, int& stride) override {
+      if constexpr (kBytesPerPixel == 4) {
+        format = F;
+        stride = Stride();
+        return reinterpret_cast<uint32_t*>(PixelAt(pos.x, pos.y));
+      } else {
+        return nullptr;
+      }
+    }
+
+  private:
+    uint8_t* PixelAt(int x, int y) const {
+      return Buffer() + (Stride() * y + x) * kBytesPerPixel;
+    }
+    // 1行の中の n 画素を v で埋める
+    void FillRow(uint8_t* p, int n, uint32_t v);
 };
 
+using RGBResv8BitPerColorPixelWriter = FormatPixelWriter<kPixelRGBResv8BitPerColor>;
+using BGRResv8BitPerColorPixelWriter = FormatPixelWriter<kPixelBGRResv8BitPerColor>;
+using RGB565PixelWriter = FormatPixelWriter<kPixelRGB565>;
+using BGR8BitPerColorPixelWriter = FormatPixelWriter<kPixelBGR8BitPerColor>;
+
+// 32 ビットの値 v を dst から n 個並べる
+void FillPixels32(uint32_t* dst, int n, uint32_t v);
+// 32 ビットの画素を n 個コピーする。領域は重ならないこと
+void CopyPixels32(uint32_t* dst, const uint32_t* src, int n);
+// 予約バイトに透明度を持つ src を dst に重ねる (source-over)。書き換えた画素の予約バイトは 0 になる
+void BlendPixels32(uint32_t* dst, const uint32_t* src, int n);
+
 void DrawRectangle(PixelWriter& writer, const Vector2D<int>& pos, const Vector2D<int>& size, const PixelColor& color);
 void FillRectangle(PixelWriter& writer, const Vector2D<int>& pos, const Vector2D<int>& size, const PixelColor& color);
+// p0 から p1 までの線分（両端を含む）を描く
+void DrawLine(PixelWriter& writer, Vector2D<int> p0, Vector2D<int> p1, const PixelColor& color);
 
 const PixelColor kDesktopBGColor{45, 118, 237};
 const PixelColor kDesktopFGColor{255, 255, 255};
@@ -130,6 +276,9 @@ void DrawDesktop(PixelWriter& writer);
 
 inline FrameBufferConfig screen_config;
 inline PixelWriter* screen_writer;
+// ウィンドウや合成用バッファの形式。合成やアルファ合成は 32 ビットの画素を前提にするので、
+// 画面が 16/24 ビットでも、これは対応する 32 ビットの形式になる。画面へは転送するときに変換する
+inline PixelFormat window_pixel_format;
 
 void InitializeGraphics(const FrameBufferConfig& config);
 Vector2D<int> ScreenSize();
@@ -0,0 +1,3063 @@
+// hankaku.txt から tools/makefont.py で生成したファイル。直接編集しないこと
+#pragma once
+
+#include "font.hpp"
+
+inline constexpr Font<8, 16, 256, 2796> kHankakuFont{
+  {
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 0, 0},  // 0x00
+    {{0x10, 0x10, 0x38, 0x38, 0x7c, 0x7c, 0xfe, 0xfe, 0x7c, 0x7c, 0x38, 0x38, 0x10, 0x10, 0x00, 0x00}, 0, 14, 0, 14},  // 0x01
+    {{0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x00, 0x00}, 0, 14, 14, 70},  // 0x02
+    {{0x00, 0x88, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x88, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08}, 1, 16, 70, 90},  // 0x03
+    {{0x00, 0xf8, 0x80, 0x80, 0xf0, 0x80, 0x80, 0x80, 0x3e, 0x20, 0x20, 0x3c, 0x20, 0x20, 0x20, 0x00}, 1, 15, 90, 104},  // 0x04
+    {{0x00, 0x70, 0x88, 0x80, 0x80, 0x80, 0x88, 0x70, 0x00, 0x3c, 0x22, 0x22, 0x3c, 0x28, 0x24, 0x22}, 1, 16, 104, 125},  // 0x05
+    {{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xf8, 0x00, 0x3e, 0x20, 0x20, 0x3c, 0x20, 0x20, 0x20}, 1, 16, 125, 139},  // 0x06
+    {{0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 2, 7, 139, 147},  // 0x07
+    {{0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0xfe, 0x10, 0x10, 0x10, 0x10, 0x00, 0xfe, 0x00, 0x00, 0x00}, 2, 13, 147, 157},  // 0x08
+    {{0x00, 0x84, 0xc4, 0xa4, 0xa4, 0x94, 0x94, 0x8c, 0x84, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3e}, 1, 16, 157, 184},  // 0x09
+    {{0x00, 0x00, 0x88, 0x88, 0x88, 0x50, 0x50, 0x20, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00}, 2, 15, 184, 201},  // 0x0a
+    {{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 9, 201, 210},  // 0x0b
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10}, 8, 16, 210, 218},  // 0x0c
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10}, 8, 16, 218, 226},  // 0x0d
+    {{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 9, 226, 235},  // 0x0e
+    {{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xff, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10}, 0, 16, 235, 251},  // 0x0f
+    {{0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 2, 3, 251, 252},  // 0x10
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 5, 6, 252, 253},  // 0x11
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, 9, 253, 254},  // 0x12
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00}, 11, 12, 254, 255},  // 0x13
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00}, 14, 15, 255, 256},  // 0x14
+    {{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10}, 0, 16, 256, 272},  // 0x15
+    {{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xf0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10}, 0, 16, 272, 288},  // 0x16
+    {{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 9, 288, 297},  // 0x17
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10}, 8, 16, 297, 305},  // 0x18
+    {{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10}, 0, 16, 305, 321},  // 0x19
+    {{0x00, 0x00, 0x02, 0x0c, 0x30, 0xc0, 0x30, 0x0c, 0x02, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00}, 2, 13, 321, 330},  // 0x1a
+    {{0x00, 0x00, 0x00, 0x80, 0x60, 0x18, 0x06, 0x18, 0x60, 0x80, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00}, 3, 13, 330, 339},  // 0x1b
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x24, 0x24, 0x24, 0x24, 0x44, 0x84, 0x00, 0x00}, 7, 14, 339, 352},  // 0x1c
+    {{0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0xfe, 0x10, 0xfe, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00}, 4, 13, 352, 361},  // 0x1d
+    {{0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x3c, 0x52, 0x20, 0x00}, 4, 15, 361, 375},  // 0x1e
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, 9, 375, 376},  // 0x1f
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 376, 376},  // 0x20
+    {{0x00, 0x18, 0x18, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00}, 1, 15, 376, 388},  // 0x21
+    {{0x6c, 0x24, 0x24, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 4, 388, 396},  // 0x22
+    {{0x00, 0x12, 0x12, 0x12, 0x7f, 0x24, 0x24, 0x24, 0x24, 0x24, 0xfe, 0x48, 0x48, 0x48, 0x48, 0x00}, 1, 15, 396, 422},  // 0x23
+    {{0x10, 0x38, 0x54, 0x92, 0x92, 0x90, 0x50, 0x38, 0x14, 0x12, 0x92, 0x92, 0x54, 0x38, 0x10, 0x10}, 0, 16, 422, 454},  // 0x24
+    {{0x01, 0x61, 0x92, 0x92, 0x94, 0x94, 0x68, 0x08, 0x10, 0x16, 0x29, 0x29, 0x49, 0x49, 0x86, 0x80}, 0, 16, 454, 490},  // 0x25
+    {{0x00, 0x38, 0x44, 0x44, 0x44, 0x28, 0x10, 0x30, 0x4a, 0x8a, 0x84, 0x84, 0x4a, 0x31, 0x00, 0x00}, 1, 14, 490, 516},  // 0x26
+    {{0x60, 0x20, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 4, 516, 520},  // 0x27
+    {{0x00, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02}, 1, 16, 520, 535},  // 0x28
+    {{0x00, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40}, 1, 16, 535, 550},  // 0x29
+    {{0x00, 0x00, 0x00, 0x00, 0x10, 0x92, 0x54, 0x38, 0x54, 0x92, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00}, 4, 11, 550, 565},  // 0x2a
+    {{0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0xfe, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00}, 3, 12, 565, 574},  // 0x2b
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x20, 0x20, 0x40}, 12, 16, 574, 578},  // 0x2c
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 7, 8, 578, 579},  // 0x2d
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00}, 12, 14, 579, 581},  // 0x2e
+    {{0x00, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, 0x00}, 1, 15, 581, 595},  // 0x2f
+    {{0x00, 0x18, 0x24, 0x24, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x24, 0x24, 0x18, 0x00, 0x00}, 1, 14, 595, 619},  // 0x30
+    {{0x00, 0x10, 0x10, 0x30, 0x50, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00}, 1, 14, 619, 633},  // 0x31
+    {{0x00, 0x18, 0x24, 0x42, 0x42, 0x02, 0x04, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x7e, 0x00, 0x00}, 1, 14, 633, 649},  // 0x32
+    {{0x00, 0x38, 0x44, 0x82, 0x82, 0x02, 0x04, 0x38, 0x04, 0x02, 0x82, 0x82, 0x44, 0x38, 0x00, 0x00}, 1, 14, 649, 668},  // 0x33
+    {{0x00, 0x08, 0x18, 0x18, 0x28, 0x28, 0x48, 0x48, 0x88, 0xfe, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00}, 1, 14, 668, 686},  // 0x34
+    {{0x00, 0x7c, 0x40, 0x40, 0x40, 0xb8, 0xc4, 0x82, 0x02, 0x02, 0x82, 0x82, 0x44, 0x38, 0x00, 0x00}, 1, 14, 686, 705},  // 0x35
+    {{0x00, 0x38, 0x44, 0x40, 0x80, 0x80, 0xb8, 0xc4, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x00, 0x00}, 1, 14, 705, 726},  // 0x36
+    {{0x00, 0xfe, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00}, 1, 15, 726, 740},  // 0x37
+    {{0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x44, 0x38, 0x44, 0x82, 0x82, 0x82, 0x44, 0x38, 0x00, 0x00}, 1, 14, 740, 763},  // 0x38
+    {{0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0x46, 0x3a, 0x02, 0x02, 0x82, 0x44, 0x38, 0x00, 0x00}, 1, 14, 763, 785},  // 0x39
+    {{0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00}, 4, 13, 785, 789},  // 0x3a
+    {{0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x08, 0x10, 0x00, 0x00}, 4, 14, 789, 795},  // 0x3b
+    {{0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00}, 3, 13, 795, 805},  // 0x3c
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 5, 10, 805, 807},  // 0x3d
+    {{0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, 0x00}, 3, 13, 807, 817},  // 0x3e
+    {{0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x04, 0x08, 0x08, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00}, 1, 15, 817, 833},  // 0x3f
+    {{0x00, 0x18, 0x24, 0x42, 0x5a, 0xb5, 0xa5, 0xa5, 0xa5, 0x9a, 0x40, 0x40, 0x22, 0x1c, 0x00, 0x00}, 1, 14, 833, 865},  // 0x40
+    {{0x00, 0x10, 0x10, 0x28, 0x28, 0x28, 0x44, 0x44, 0x44, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00}, 1, 14, 865, 888},  // 0x41
+    {{0x00, 0xf0, 0x88, 0x84, 0x84, 0x84, 0x88, 0xf8, 0x84, 0x82, 0x82, 0x82, 0x84, 0xf8, 0x00, 0x00}, 1, 14, 888, 911},  // 0x42
+    {{0x00, 0x38, 0x44, 0x42, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x42, 0x44, 0x38, 0x00, 0x00}, 1, 14, 911, 928},  // 0x43
+    {{0x00, 0xf0, 0x88, 0x84, 0x84, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x84, 0x88, 0xf0, 0x00, 0x00}, 1, 14, 928, 952},  // 0x44
+    {{0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x00}, 1, 14, 952, 965},  // 0x45
+    {{0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00}, 1, 14, 965, 978},  // 0x46
+    {{0x00, 0x18, 0x24, 0x42, 0x40, 0x80, 0x80, 0x8e, 0x82, 0x82, 0x82, 0x42, 0x66, 0x1a, 0x00, 0x00}, 1, 14, 978, 1000},  // 0x47
+    {{0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00}, 1, 14, 1000, 1025},  // 0x48
+    {{0x00, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00}, 1, 14, 1025, 1038},  // 0x49
+    {{0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x42, 0x24, 0x18, 0x00, 0x00}, 1, 14, 1038, 1053},  // 0x4a
+    {{0x00, 0x42, 0x42, 0x44, 0x44, 0x48, 0x58, 0x68, 0x64, 0x44, 0x42, 0x42, 0x41, 0x41, 0x00, 0x00}, 1, 14, 1053, 1079},  // 0x4b
+    {{0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7e, 0x00, 0x00}, 1, 14, 1079, 1092},  // 0x4c
+    {{0x00, 0x82, 0x82, 0xc6, 0xc6, 0xc6, 0xaa, 0xaa, 0xaa, 0x92, 0x92, 0x92, 0x92, 0x82, 0x00, 0x00}, 1, 14, 1092, 1128},  // 0x4d
+    {{0x00, 0x82, 0xc2, 0xc2, 0xa2, 0xa2, 0x92, 0x92, 0x92, 0x8a, 0x8a, 0x86, 0x86, 0x82, 0x00, 0x00}, 1, 14, 1128, 1161},  // 0x4e
+    {{0x00, 0x38, 0x44, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x44, 0x38, 0x00, 0x00}, 1, 14, 1161, 1185},  // 0x4f
+    {{0x00, 0xf8, 0x84, 0x82, 0x82, 0x82, 0x84, 0xf8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00}, 1, 14, 1185, 1203},  // 0x50
+    {{0x00, 0x38, 0x44, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xba, 0x44, 0x44, 0x38, 0x08, 0x06}, 1, 16, 1203, 1230},  // 0x51
+    {{0x00, 0xf8, 0x84, 0x82, 0x82, 0x82, 0x84, 0xf8, 0x88, 0x84, 0x84, 0x84, 0x82, 0x82, 0x00, 0x00}, 1, 14, 1230, 1254},  // 0x52
+    {{0x00, 0x38, 0x44, 0x82, 0x82, 0x80, 0x60, 0x18, 0x04, 0x02, 0x82, 0x82, 0x44, 0x38, 0x00, 0x00}, 1, 14, 1254, 1273},  // 0x53
+    {{0x00, 0xfe, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00}, 1, 14, 1273, 1286},  // 0x54
+    {{0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x00, 0x00}, 1, 14, 1286, 1311},  // 0x55
+    {{0x00, 0x82, 0x82, 0x82, 0x82, 0x44, 0x44, 0x44, 0x28, 0x28, 0x28, 0x10, 0x10, 0x10, 0x00, 0x00}, 1, 14, 1311, 1334},  // 0x56
+    {{0x00, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xaa, 0xaa, 0x6c, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00}, 1, 14, 1334, 1370},  // 0x57
+    {{0x00, 0x82, 0x44, 0x44, 0x28, 0x28, 0x10, 0x28, 0x28, 0x28, 0x44, 0x44, 0x82, 0x82, 0x00, 0x00}, 1, 14, 1370, 1395},  // 0x58
+    {{0x00, 0x82, 0x82, 0x44, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00}, 1, 14, 1395, 1415},  // 0x59
+    {{0x00, 0xfe, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0xfe, 0x00, 0x00}, 1, 14, 1415, 1428},  // 0x5a
+    {{0x1e, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1e}, 0, 16, 1428, 1444},  // 0x5b
+    {{0x00, 0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x00}, 1, 15, 1444, 1458},  // 0x5c
+    {{0xf0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xf0}, 0, 16, 1458, 1474},  // 0x5d
+    {{0x10, 0x28, 0x44, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 4, 1474, 1481},  // 0x5e
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00}, 14, 15, 1481, 1482},  // 0x5f
+    {{0x30, 0x20, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 4, 1482, 1486},  // 0x60
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x3e, 0x42, 0x82, 0x82, 0x86, 0x7a, 0x00, 0x00}, 5, 14, 1486, 1501},  // 0x61
+    {{0x00, 0x80, 0x80, 0x80, 0x80, 0xb8, 0xc4, 0x82, 0x82, 0x82, 0x82, 0x82, 0xc4, 0xb8, 0x00, 0x00}, 1, 14, 1501, 1523},  // 0x62
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x82, 0x80, 0x80, 0x80, 0x82, 0x44, 0x38, 0x00, 0x00}, 5, 14, 1523, 1536},  // 0x63
+    {{0x00, 0x02, 0x02, 0x02, 0x02, 0x3a, 0x46, 0x82, 0x82, 0x82, 0x82, 0x82, 0x46, 0x3a, 0x00, 0x00}, 1, 14, 1536, 1558},  // 0x64
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x82, 0x82, 0xfe, 0x80, 0x82, 0x44, 0x38, 0x00, 0x00}, 5, 14, 1558, 1572},  // 0x65
+    {{0x00, 0x0c, 0x10, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00}, 1, 14, 1572, 1585},  // 0x66
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x44, 0x44, 0x44, 0x38, 0x40, 0x78, 0x84, 0x82, 0x82, 0x7c}, 5, 16, 1585, 1603},  // 0x67
+    {{0x00, 0x40, 0x40, 0x40, 0x40, 0x5c, 0x62, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00}, 1, 14, 1603, 1625},  // 0x68
+    {{0x00, 0x10, 0x10, 0x00, 0x00, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00}, 1, 14, 1625, 1636},  // 0x69
+    {{0x00, 0x08, 0x08, 0x00, 0x00, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x60}, 1, 16, 1636, 1649},  // 0x6a
+    {{0x00, 0x40, 0x40, 0x40, 0x40, 0x42, 0x44, 0x48, 0x50, 0x68, 0x44, 0x44, 0x42, 0x42, 0x00, 0x00}, 1, 14, 1649, 1671},  // 0x6b
+    {{0x00, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00}, 1, 14, 1671, 1684},  // 0x6c
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x00, 0x00}, 5, 14, 1684, 1710},  // 0x6d
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x62, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00}, 5, 14, 1710, 1728},  // 0x6e
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x00, 0x00}, 5, 14, 1728, 1744},  // 0x6f
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xc4, 0x82, 0x82, 0x82, 0x82, 0xc4, 0xb8, 0x80, 0x80, 0x80}, 5, 16, 1744, 1763},  // 0x70
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x46, 0x82, 0x82, 0x82, 0x82, 0x46, 0x3a, 0x02, 0x02, 0x02}, 5, 16, 1763, 1782},  // 0x71
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00}, 5, 14, 1782, 1792},  // 0x72
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x40, 0x60, 0x18, 0x06, 0x02, 0x42, 0x3c, 0x00, 0x00}, 5, 14, 1792, 1803},  // 0x73
+    {{0x00, 0x00, 0x10, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0c, 0x00, 0x00}, 2, 14, 1803, 1815},  // 0x74
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3a, 0x00, 0x00}, 5, 14, 1815, 1833},  // 0x75
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x00, 0x00}, 5, 14, 1833, 1849},  // 0x76
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x92, 0x92, 0xaa, 0xaa, 0x44, 0x44, 0x44, 0x00, 0x00}, 5, 14, 1849, 1875},  // 0x77
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x44, 0x28, 0x28, 0x10, 0x28, 0x28, 0x44, 0x82, 0x00, 0x00}, 5, 14, 1875, 1892},  // 0x78
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x44, 0x44, 0x28, 0x28, 0x18, 0x10, 0x10, 0x20, 0xc0}, 5, 16, 1892, 1909},  // 0x79
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xfe, 0x00, 0x00}, 5, 14, 1909, 1918},  // 0x7a
+    {{0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04}, 0, 16, 1918, 1934},  // 0x7b
+    {{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10}, 0, 16, 1934, 1950},  // 0x7c
+    {{0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40}, 0, 16, 1950, 1966},  // 0x7d
+    {{0x00, 0x00, 0x00, 0x60, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 3, 6, 1966, 1971},  // 0x7e
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x7f
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x80
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x81
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x82
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x83
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x84
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x85
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x86
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x87
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x88
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x89
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x8a
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x8b
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x8c
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x8d
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x8e
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x8f
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x90
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x91
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x92
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x93
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x94
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x95
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x96
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x97
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x98
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x99
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x9a
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x9b
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x9c
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x9d
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x9e
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0x9f
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 1971, 1971},  // 0xa0
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0x50, 0x20, 0x00}, 11, 15, 1971, 1977},  // 0xa1
+    {{0x00, 0x3e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 1, 10, 1977, 1986},  // 0xa2
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xf0, 0x00}, 6, 15, 1986, 1995},  // 0xa3
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x10, 0x00}, 12, 15, 1995, 1998},  // 0xa4
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 7, 9, 1998, 2000},  // 0xa5
+    {{0x00, 0x00, 0x7e, 0x02, 0x02, 0x02, 0x7e, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00}, 2, 14, 2000, 2012},  // 0xa6
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x24, 0x28, 0x30, 0x20, 0x40, 0x40, 0x80, 0x00}, 7, 15, 2012, 2022},  // 0xa7
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x10, 0x30, 0x50, 0x90, 0x10, 0x10, 0x10, 0x00}, 6, 15, 2022, 2033},  // 0xa8
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xfc, 0x84, 0x84, 0x88, 0x08, 0x10, 0x20, 0x00}, 6, 15, 2033, 2045},  // 0xa9
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x10, 0x10, 0x10, 0x10, 0xfe, 0x00, 0x00}, 8, 14, 2045, 2051},  // 0xaa
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0xfe, 0x08, 0x18, 0x28, 0x48, 0x88, 0x18, 0x00}, 6, 15, 2051, 2063},  // 0xab
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x3e, 0xe4, 0x28, 0x10, 0x10, 0x10, 0x00, 0x00}, 6, 14, 2063, 2073},  // 0xac
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x08, 0x08, 0x08, 0xfe, 0x00, 0x00, 0x00}, 8, 13, 2073, 2078},  // 0xad
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x04, 0x04, 0x7c, 0x04, 0x04, 0x7c, 0x00, 0x00}, 7, 14, 2078, 2085},  // 0xae
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x94, 0x54, 0x44, 0x08, 0x08, 0x10, 0x20, 0x00, 0x00}, 6, 14, 2085, 2099},  // 0xaf
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 6, 7, 2099, 2100},  // 0xb0
+    {{0x00, 0x00, 0xfe, 0x02, 0x12, 0x12, 0x14, 0x18, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x00, 0x00}, 2, 14, 2100, 2115},  // 0xb1
+    {{0x00, 0x02, 0x02, 0x04, 0x04, 0x08, 0x18, 0x28, 0x48, 0x88, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00}, 1, 14, 2115, 2131},  // 0xb2
+    {{0x00, 0x10, 0x10, 0x10, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x04, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00}, 1, 14, 2131, 2148},  // 0xb3
+    {{0x00, 0x00, 0x00, 0xfe, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xff, 0x00, 0x00, 0x00}, 3, 13, 2148, 2158},  // 0xb4
+    {{0x00, 0x08, 0x08, 0x08, 0xfe, 0x08, 0x18, 0x18, 0x28, 0x28, 0x48, 0x88, 0x08, 0x18, 0x00, 0x00}, 1, 14, 2158, 2175},  // 0xb5
+    {{0x00, 0x10, 0x10, 0x10, 0xfe, 0x12, 0x12, 0x12, 0x12, 0x22, 0x22, 0x22, 0x42, 0x8c, 0x00, 0x00}, 1, 14, 2175, 2197},  // 0xb6
+    {{0x00, 0x20, 0x20, 0x3c, 0xe0, 0x10, 0x10, 0x1e, 0xf0, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00}, 1, 14, 2197, 2210},  // 0xb7
+    {{0x00, 0x20, 0x20, 0x3e, 0x22, 0x22, 0x42, 0x44, 0x84, 0x08, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00}, 1, 14, 2210, 2228},  // 0xb8
+    {{0x00, 0x40, 0x40, 0x40, 0x7e, 0x48, 0x48, 0x48, 0x88, 0x08, 0x10, 0x10, 0x20, 0x40, 0x00, 0x00}, 1, 14, 2228, 2245},  // 0xb9
+    {{0x00, 0x00, 0x00, 0xfe, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfe, 0x02, 0x00, 0x00, 0x00}, 3, 13, 2245, 2255},  // 0xba
+    {{0x00, 0x24, 0x24, 0x24, 0x24, 0xfe, 0x24, 0x24, 0x24, 0x24, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00}, 1, 14, 2255, 2276},  // 0xbb
+    {{0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0xc2, 0x22, 0x04, 0x04, 0x08, 0x10, 0x20, 0xc0, 0x00, 0x00}, 2, 14, 2276, 2288},  // 0xbc
+    {{0x00, 0x00, 0x00, 0xfe, 0x04, 0x04, 0x04, 0x08, 0x08, 0x18, 0x14, 0x24, 0x42, 0x82, 0x00, 0x00}, 3, 14, 2288, 2303},  // 0xbd
+    {{0x00, 0x40, 0x40, 0x40, 0x40, 0x4e, 0x72, 0xc4, 0x48, 0x40, 0x40, 0x40, 0x40, 0x3e, 0x00, 0x00}, 1, 14, 2303, 2320},  // 0xbe
+    {{0x00, 0x00, 0x02, 0x82, 0x42, 0x42, 0x42, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00}, 2, 14, 2320, 2336},  // 0xbf
+    {{0x00, 0x20, 0x20, 0x3e, 0x22, 0x42, 0x62, 0x54, 0x8c, 0x08, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00}, 1, 14, 2336, 2355},  // 0xc0
+    {{0x00, 0x02, 0x0c, 0x78, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00}, 1, 14, 2355, 2368},  // 0xc1
+    {{0x00, 0x00, 0x20, 0x22, 0x92, 0x92, 0x42, 0x44, 0x04, 0x08, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00}, 2, 14, 2368, 2387},  // 0xc2
+    {{0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0xfe, 0x08, 0x08, 0x08, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00}, 2, 14, 2387, 2396},  // 0xc3
+    {{0x00, 0x20, 0x20, 0x20, 0x20, 0x30, 0x28, 0x24, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00}, 1, 14, 2396, 2413},  // 0xc4
+    {{0x00, 0x08, 0x08, 0x08, 0xfe, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x00, 0x00}, 1, 14, 2413, 2426},  // 0xc5
+    {{0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00}, 3, 12, 2426, 2428},  // 0xc6
+    {{0x00, 0x00, 0x7e, 0x02, 0x02, 0x24, 0x14, 0x08, 0x0c, 0x14, 0x12, 0x22, 0x40, 0x80, 0x00, 0x00}, 2, 14, 2428, 2445},  // 0xc7
+    {{0x10, 0x10, 0x10, 0xfe, 0x04, 0x04, 0x08, 0x18, 0x34, 0x52, 0x92, 0x10, 0x10, 0x10, 0x00, 0x00}, 0, 14, 2445, 2464},  // 0xc8
+    {{0x00, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00}, 1, 13, 2464, 2476},  // 0xc9
+    {{0x00, 0x00, 0x08, 0x08, 0x24, 0x24, 0x24, 0x22, 0x22, 0x22, 0x22, 0x42, 0x42, 0x82, 0x00, 0x00}, 2, 14, 2476, 2498},  // 0xca
+    {{0x00, 0x40, 0x40, 0x40, 0x42, 0x4c, 0x70, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3e, 0x00, 0x00}, 1, 14, 2498, 2513},  // 0xcb
+    {{0x00, 0x00, 0xfe, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00}, 2, 14, 2513, 2525},  // 0xcc
+    {{0x00, 0x00, 0x20, 0x20, 0x50, 0x50, 0x88, 0x88, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00}, 2, 11, 2525, 2538},  // 0xcd
+    {{0x00, 0x10, 0x10, 0x10, 0xfe, 0x10, 0x18, 0x54, 0x54, 0x52, 0x52, 0x92, 0x10, 0x30, 0x00, 0x00}, 1, 14, 2538, 2561},  // 0xce
+    {{0x00, 0x00, 0x00, 0xfe, 0x02, 0x02, 0x04, 0x04, 0xc8, 0x30, 0x10, 0x08, 0x04, 0x04, 0x00, 0x00}, 3, 14, 2561, 2573},  // 0xcf
+    {{0x00, 0x60, 0x18, 0x04, 0x00, 0x00, 0x60, 0x18, 0x04, 0x00, 0xe0, 0x18, 0x04, 0x02, 0x00, 0x00}, 1, 14, 2573, 2583},  // 0xd0
+    {{0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x28, 0x24, 0x24, 0x22, 0x4e, 0xf2, 0x02, 0x00, 0x00}, 1, 14, 2583, 2602},  // 0xd1
+    {{0x00, 0x04, 0x04, 0x04, 0x04, 0x64, 0x18, 0x08, 0x0c, 0x12, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00}, 1, 14, 2602, 2617},  // 0xd2
+    {{0x00, 0x00, 0xfe, 0x20, 0x20, 0x20, 0xfe, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x00, 0x00, 0x00}, 2, 13, 2617, 2628},  // 0xd3
+    {{0x00, 0x20, 0x20, 0x20, 0x17, 0x39, 0xd2, 0x12, 0x0c, 0x08, 0x08, 0x04, 0x04, 0x04, 0x00, 0x00}, 1, 14, 2628, 2646},  // 0xd4
+    {{0x00, 0x00, 0x00, 0x00, 0x7c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xff, 0x00, 0x00, 0x00}, 4, 13, 2646, 2655},  // 0xd5
+    {{0x00, 0x00, 0xfe, 0x02, 0x02, 0x02, 0x02, 0x7e, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfe, 0x00, 0x00}, 2, 14, 2655, 2667},  // 0xd6
+    {{0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x60, 0x00, 0x00}, 2, 14, 2667, 2676},  // 0xd7
+    {{0x00, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x08, 0x08, 0x10, 0x20, 0x00, 0x00}, 1, 14, 2676, 2696},  // 0xd8
+    {{0x00, 0x08, 0x08, 0x28, 0x28, 0x28, 0x28, 0x29, 0x29, 0x2a, 0x4a, 0x4c, 0x48, 0x80, 0x00, 0x00}, 1, 14, 2696, 2723},  // 0xd9
+    {{0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x44, 0x44, 0x48, 0x50, 0x60, 0x00, 0x00}, 2, 14, 2723, 2740},  // 0xda
+    {{0x00, 0x00, 0x00, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x00, 0x00, 0x00}, 3, 13, 2740, 2758},  // 0xdb
+    {{0x00, 0x00, 0x00, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x02, 0x04, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00}, 3, 14, 2758, 2773},  // 0xdc
+    {{0x00, 0x00, 0x00, 0xc0, 0x20, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x20, 0xc0, 0x00, 0x00}, 3, 14, 2773, 2784},  // 0xdd
+    {{0x00, 0x90, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 1, 4, 2784, 2790},  // 0xde
+    {{0x00, 0x60, 0x90, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 1, 5, 2790, 2796},  // 0xdf
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xe0
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xe1
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xe2
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xe3
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xe4
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xe5
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xe6
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xe7
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xe8
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xe9
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xea
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xeb
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xec
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xed
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xee
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xef
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xf0
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xf1
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xf2
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xf3
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xf4
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xf5
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xf6
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xf7
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xf8
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xf9
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xfa
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xfb
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xfc
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xfd
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xfe
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 0, 2796, 2796},  // 0xff
+  },
+  {
+    {0, 3, 1},
+    {1, 3, 1},
+    {2, 2, 3},
+    {3, 2, 3},
+    {4, 1, 5},
+    {5, 1, 5},
+    {6, 0, 7},
+    {7, 0, 7},
+    {8, 1, 5},
+    {9, 1, 5},
+    {10, 2, 3},
+    {11, 2, 3},
+    {12, 3, 1},
+    {13, 3, 1},
+    {0, 1, 1},
+    {0, 3, 1},
+    {0, 5, 1},
+    {0, 7, 1},
+    {1, 0, 1},
+    {1, 2, 1},
+    {1, 4, 1},
+    {1, 6, 1},
+    {2, 1, 1},
+    {2, 3, 1},
+    {2, 5, 1},
+    {2, 7, 1},
+    {3, 0, 1},
+    {3, 2, 1},
+    {3, 4, 1},
+    {3, 6, 1},
+    {4, 1, 1},
+    {4, 3, 1},
+    {4, 5, 1},
+    {4, 7, 1},
+    {5, 0, 1},
+    {5, 2, 1},
+    {5, 4, 1},
+    {5, 6, 1},
+    {6, 1, 1},
+    {6, 3, 1},
+    {6, 5, 1},
+    {6, 7, 1},
+    {7, 0, 1},
+    {7, 2, 1},
+    {7, 4, 1},
+    {7, 6, 1},
+    {8, 1, 1},
+    {8, 3, 1},
+    {8, 5, 1},
+    {8, 7, 1},
+    {9, 0, 1},
+    {9, 2, 1},
+    {9, 4, 1},
+    {9, 6, 1},
+    {10, 1, 1},
+    {10, 3, 1},
+    {10, 5, 1},
+    {10, 7, 1},
+    {11, 0, 1},
+    {11, 2, 1},
+    {11, 4, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 3, 1},
+    {12, 5, 1},
+    {12, 7, 1},
+    {13, 0, 1},
+    {13, 2, 1},
+    {13, 4, 1},
+    {13, 6, 1},
+    {1, 0, 1},
+    {1, 4, 1},
+    {2, 0, 1},
+    {2, 4, 1},
+    {3, 0, 1},
+    {3, 4, 1},
+    {4, 0, 5},
+    {5, 0, 1},
+    {5, 4, 1},
+    {6, 0, 1},
+    {6, 4, 1},
+    {7, 0, 1},
+    {7, 4, 1},
+    {9, 2, 5},
+    {10, 4, 1},
+    {11, 4, 1},
+    {12, 4, 1},
+    {13, 4, 1},
+    {14, 4, 1},
+    {15, 4, 1},
+    {1, 0, 5},
+    {2, 0, 1},
+    {3, 0, 1},
+    {4, 0, 4},
+    {5, 0, 1},
+    {6, 0, 1},
+    {7, 0, 1},
+    {8, 2, 5},
+    {9, 2, 1},
+    {10, 2, 1},
+    {11, 2, 4},
+    {12, 2, 1},
+    {13, 2, 1},
+    {14, 2, 1},
+    {1, 1, 3},
+    {2, 0, 1},
+    {2, 4, 1},
+    {3, 0, 1},
+    {4, 0, 1},
+    {5, 0, 1},
+    {6, 0, 1},
+    {6, 4, 1},
+    {7, 1, 3},
+    {9, 2, 4},
+    {10, 2, 1},
+    {10, 6, 1},
+    {11, 2, 1},
+    {11, 6, 1},
+    {12, 2, 4},
+    {13, 2, 1},
+    {13, 4, 1},
+    {14, 2, 1},
+    {14, 5, 1},
+    {15, 2, 1},
+    {15, 6, 1},
+    {1, 0, 1},
+    {2, 0, 1},
+    {3, 0, 1},
+    {4, 0, 1},
+    {5, 0, 1},
+    {6, 0, 1},
+    {7, 0, 5},
+    {9, 2, 5},
+    {10, 2, 1},
+    {11, 2, 1},
+    {12, 2, 4},
+    {13, 2, 1},
+    {14, 2, 1},
+    {15, 2, 1},
+    {2, 2, 3},
+    {3, 1, 1},
+    {3, 5, 1},
+    {4, 1, 1},
+    {4, 5, 1},
+    {5, 1, 1},
+    {5, 5, 1},
+    {6, 2, 3},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 0, 7},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {12, 0, 7},
+    {1, 0, 1},
+    {1, 5, 1},
+    {2, 0, 2},
+    {2, 5, 1},
+    {3, 0, 1},
+    {3, 2, 1},
+    {3, 5, 1},
+    {4, 0, 1},
+    {4, 2, 1},
+    {4, 5, 1},
+    {5, 0, 1},
+    {5, 3, 1},
+    {5, 5, 1},
+    {6, 0, 1},
+    {6, 3, 1},
+    {6, 5, 1},
+    {7, 0, 1},
+    {7, 4, 2},
+    {8, 0, 1},
+    {8, 5, 1},
+    {9, 2, 1},
+    {10, 2, 1},
+    {11, 2, 1},
+    {12, 2, 1},
+    {13, 2, 1},
+    {14, 2, 1},
+    {15, 2, 5},
+    {2, 0, 1},
+    {2, 4, 1},
+    {3, 0, 1},
+    {3, 4, 1},
+    {4, 0, 1},
+    {4, 4, 1},
+    {5, 1, 1},
+    {5, 3, 1},
+    {6, 1, 1},
+    {6, 3, 1},
+    {7, 2, 1},
+    {9, 2, 5},
+    {10, 4, 1},
+    {11, 4, 1},
+    {12, 4, 1},
+    {13, 4, 1},
+    {14, 4, 1},
+    {0, 3, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 0, 4},
+    {8, 0, 4},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {15, 3, 1},
+    {8, 3, 5},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {15, 3, 1},
+    {0, 3, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 5},
+    {0, 3, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 0, 8},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {15, 3, 1},
+    {2, 0, 8},
+    {5, 0, 8},
+    {8, 0, 8},
+    {11, 0, 8},
+    {14, 0, 8},
+    {0, 3, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 5},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {15, 3, 1},
+    {0, 3, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 0, 4},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {15, 3, 1},
+    {0, 3, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 0, 8},
+    {8, 0, 8},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {15, 3, 1},
+    {0, 3, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {15, 3, 1},
+    {2, 6, 1},
+    {3, 4, 2},
+    {4, 2, 2},
+    {5, 0, 2},
+    {6, 2, 2},
+    {7, 4, 2},
+    {8, 6, 1},
+    {10, 0, 7},
+    {12, 0, 7},
+    {3, 0, 1},
+    {4, 1, 2},
+    {5, 3, 2},
+    {6, 5, 2},
+    {7, 3, 2},
+    {8, 1, 2},
+    {9, 0, 1},
+    {10, 0, 7},
+    {12, 0, 7},
+    {7, 0, 7},
+    {8, 2, 1},
+    {8, 5, 1},
+    {9, 2, 1},
+    {9, 5, 1},
+    {10, 2, 1},
+    {10, 5, 1},
+    {11, 2, 1},
+    {11, 5, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 0, 1},
+    {13, 5, 1},
+    {4, 6, 1},
+    {5, 5, 1},
+    {6, 4, 1},
+    {7, 0, 7},
+    {8, 3, 1},
+    {9, 0, 7},
+    {10, 2, 1},
+    {11, 1, 1},
+    {12, 0, 1},
+    {4, 4, 2},
+    {5, 3, 1},
+    {5, 6, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 1, 5},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 2, 4},
+    {13, 1, 1},
+    {13, 3, 1},
+    {13, 6, 1},
+    {14, 2, 1},
+    {8, 3, 1},
+    {1, 3, 2},
+    {2, 3, 2},
+    {3, 3, 2},
+    {4, 3, 2},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {0, 1, 2},
+    {0, 4, 2},
+    {1, 2, 1},
+    {1, 5, 1},
+    {2, 2, 1},
+    {2, 5, 1},
+    {3, 1, 1},
+    {3, 4, 1},
+    {1, 3, 1},
+    {1, 6, 1},
+    {2, 3, 1},
+    {2, 6, 1},
+    {3, 3, 1},
+    {3, 6, 1},
+    {4, 1, 7},
+    {5, 2, 1},
+    {5, 5, 1},
+    {6, 2, 1},
+    {6, 5, 1},
+    {7, 2, 1},
+    {7, 5, 1},
+    {8, 2, 1},
+    {8, 5, 1},
+    {9, 2, 1},
+    {9, 5, 1},
+    {10, 0, 7},
+    {11, 1, 1},
+    {11, 4, 1},
+    {12, 1, 1},
+    {12, 4, 1},
+    {13, 1, 1},
+    {13, 4, 1},
+    {14, 1, 1},
+    {14, 4, 1},
+    {0, 3, 1},
+    {1, 2, 3},
+    {2, 1, 1},
+    {2, 3, 1},
+    {2, 5, 1},
+    {3, 0, 1},
+    {3, 3, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 3, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 3, 1},
+    {6, 1, 1},
+    {6, 3, 1},
+    {7, 2, 3},
+    {8, 3, 1},
+    {8, 5, 1},
+    {9, 3, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 3, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 3, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 3, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {14, 3, 1},
+    {15, 3, 1},
+    {0, 7, 1},
+    {1, 1, 2},
+    {1, 7, 1},
+    {2, 0, 1},
+    {2, 3, 1},
+    {2, 6, 1},
+    {3, 0, 1},
+    {3, 3, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 3, 1},
+    {4, 5, 1},
+    {5, 0, 1},
+    {5, 3, 1},
+    {5, 5, 1},
+    {6, 1, 2},
+    {6, 4, 1},
+    {7, 4, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {9, 5, 2},
+    {10, 2, 1},
+    {10, 4, 1},
+    {10, 7, 1},
+    {11, 2, 1},
+    {11, 4, 1},
+    {11, 7, 1},
+    {12, 1, 1},
+    {12, 4, 1},
+    {12, 7, 1},
+    {13, 1, 1},
+    {13, 4, 1},
+    {13, 7, 1},
+    {14, 0, 1},
+    {14, 5, 2},
+    {15, 0, 1},
+    {1, 2, 3},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 1, 1},
+    {3, 5, 1},
+    {4, 1, 1},
+    {4, 5, 1},
+    {5, 2, 1},
+    {5, 4, 1},
+    {6, 3, 1},
+    {7, 2, 2},
+    {8, 1, 1},
+    {8, 4, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 4, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 5, 1},
+    {11, 0, 1},
+    {11, 5, 1},
+    {12, 1, 1},
+    {12, 4, 1},
+    {12, 6, 1},
+    {13, 2, 2},
+    {13, 7, 1},
+    {0, 1, 2},
+    {1, 2, 1},
+    {2, 2, 1},
+    {3, 1, 1},
+    {1, 6, 1},
+    {2, 5, 1},
+    {3, 4, 1},
+    {4, 4, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 4, 1},
+    {13, 4, 1},
+    {14, 5, 1},
+    {15, 6, 1},
+    {1, 1, 1},
+    {2, 2, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 4, 1},
+    {6, 4, 1},
+    {7, 4, 1},
+    {8, 4, 1},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 4, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 2, 1},
+    {15, 1, 1},
+    {4, 3, 1},
+    {5, 0, 1},
+    {5, 3, 1},
+    {5, 6, 1},
+    {6, 1, 1},
+    {6, 3, 1},
+    {6, 5, 1},
+    {7, 2, 3},
+    {8, 1, 1},
+    {8, 3, 1},
+    {8, 5, 1},
+    {9, 0, 1},
+    {9, 3, 1},
+    {9, 6, 1},
+    {10, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 0, 7},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 1, 2},
+    {13, 2, 1},
+    {14, 2, 1},
+    {15, 1, 1},
+    {7, 0, 7},
+    {12, 1, 2},
+    {13, 1, 2},
+    {1, 6, 1},
+    {2, 6, 1},
+    {3, 5, 1},
+    {4, 5, 1},
+    {5, 4, 1},
+    {6, 4, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 2, 1},
+    {10, 2, 1},
+    {11, 1, 1},
+    {12, 1, 1},
+    {13, 0, 1},
+    {14, 0, 1},
+    {1, 3, 2},
+    {2, 2, 1},
+    {2, 5, 1},
+    {3, 2, 1},
+    {3, 5, 1},
+    {4, 1, 1},
+    {4, 6, 1},
+    {5, 1, 1},
+    {5, 6, 1},
+    {6, 1, 1},
+    {6, 6, 1},
+    {7, 1, 1},
+    {7, 6, 1},
+    {8, 1, 1},
+    {8, 6, 1},
+    {9, 1, 1},
+    {9, 6, 1},
+    {10, 1, 1},
+    {10, 6, 1},
+    {11, 2, 1},
+    {11, 5, 1},
+    {12, 2, 1},
+    {12, 5, 1},
+    {13, 3, 2},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 2, 2},
+    {4, 1, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {1, 3, 2},
+    {2, 2, 1},
+    {2, 5, 1},
+    {3, 1, 1},
+    {3, 6, 1},
+    {4, 1, 1},
+    {4, 6, 1},
+    {5, 6, 1},
+    {6, 5, 1},
+    {7, 4, 1},
+    {8, 3, 1},
+    {9, 2, 1},
+    {10, 2, 1},
+    {11, 1, 1},
+    {12, 1, 1},
+    {13, 1, 6},
+    {1, 2, 3},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 0, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 6, 1},
+    {6, 5, 1},
+    {7, 2, 3},
+    {8, 5, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {1, 4, 1},
+    {2, 3, 2},
+    {3, 3, 2},
+    {4, 2, 1},
+    {4, 4, 1},
+    {5, 2, 1},
+    {5, 4, 1},
+    {6, 1, 1},
+    {6, 4, 1},
+    {7, 1, 1},
+    {7, 4, 1},
+    {8, 0, 1},
+    {8, 4, 1},
+    {9, 0, 7},
+    {10, 4, 1},
+    {11, 4, 1},
+    {12, 4, 1},
+    {13, 4, 1},
+    {1, 1, 5},
+    {2, 1, 1},
+    {3, 1, 1},
+    {4, 1, 1},
+    {5, 0, 1},
+    {5, 2, 3},
+    {6, 0, 2},
+    {6, 5, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 6, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {1, 2, 3},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 1, 1},
+    {4, 0, 1},
+    {5, 0, 1},
+    {6, 0, 1},
+    {6, 2, 3},
+    {7, 0, 2},
+    {7, 5, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {1, 0, 7},
+    {2, 6, 1},
+    {3, 5, 1},
+    {4, 5, 1},
+    {5, 4, 1},
+    {6, 4, 1},
+    {7, 4, 1},
+    {8, 4, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {1, 2, 3},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 0, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 1, 1},
+    {6, 5, 1},
+    {7, 2, 3},
+    {8, 1, 1},
+    {8, 5, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {1, 2, 3},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 0, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 6, 1},
+    {7, 1, 1},
+    {7, 5, 2},
+    {8, 2, 3},
+    {8, 6, 1},
+    {9, 6, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {4, 3, 2},
+    {5, 3, 2},
+    {11, 3, 2},
+    {12, 3, 2},
+    {4, 3, 2},
+    {5, 3, 2},
+    {10, 3, 2},
+    {11, 4, 1},
+    {12, 4, 1},
+    {13, 3, 1},
+    {3, 6, 1},
+    {4, 5, 1},
+    {5, 4, 1},
+    {6, 3, 1},
+    {7, 2, 1},
+    {8, 2, 1},
+    {9, 3, 1},
+    {10, 4, 1},
+    {11, 5, 1},
+    {12, 6, 1},
+    {5, 0, 7},
+    {9, 0, 7},
+    {3, 1, 1},
+    {4, 2, 1},
+    {5, 3, 1},
+    {6, 4, 1},
+    {7, 5, 1},
+    {8, 5, 1},
+    {9, 4, 1},
+    {10, 3, 1},
+    {11, 2, 1},
+    {12, 1, 1},
+    {1, 2, 3},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 0, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 5, 1},
+    {7, 4, 1},
+    {8, 4, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {1, 3, 2},
+    {2, 2, 1},
+    {2, 5, 1},
+    {3, 1, 1},
+    {3, 6, 1},
+    {4, 1, 1},
+    {4, 3, 2},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 2, 2},
+    {5, 5, 1},
+    {5, 7, 1},
+    {6, 0, 1},
+    {6, 2, 1},
+    {6, 5, 1},
+    {6, 7, 1},
+    {7, 0, 1},
+    {7, 2, 1},
+    {7, 5, 1},
+    {7, 7, 1},
+    {8, 0, 1},
+    {8, 2, 1},
+    {8, 5, 1},
+    {8, 7, 1},
+    {9, 0, 1},
+    {9, 3, 2},
+    {9, 6, 1},
+    {10, 1, 1},
+    {11, 1, 1},
+    {12, 2, 1},
+    {12, 6, 1},
+    {13, 3, 3},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 2, 1},
+    {3, 4, 1},
+    {4, 2, 1},
+    {4, 4, 1},
+    {5, 2, 1},
+    {5, 4, 1},
+    {6, 1, 1},
+    {6, 5, 1},
+    {7, 1, 1},
+    {7, 5, 1},
+    {8, 1, 1},
+    {8, 5, 1},
+    {9, 1, 5},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 0, 1},
+    {12, 6, 1},
+    {13, 0, 1},
+    {13, 6, 1},
+    {1, 0, 4},
+    {2, 0, 1},
+    {2, 4, 1},
+    {3, 0, 1},
+    {3, 5, 1},
+    {4, 0, 1},
+    {4, 5, 1},
+    {5, 0, 1},
+    {5, 5, 1},
+    {6, 0, 1},
+    {6, 4, 1},
+    {7, 0, 5},
+    {8, 0, 1},
+    {8, 5, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 0, 1},
+    {12, 5, 1},
+    {13, 0, 5},
+    {1, 2, 3},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 1, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {5, 0, 1},
+    {6, 0, 1},
+    {7, 0, 1},
+    {8, 0, 1},
+    {9, 0, 1},
+    {10, 0, 1},
+    {11, 1, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {1, 0, 4},
+    {2, 0, 1},
+    {2, 4, 1},
+    {3, 0, 1},
+    {3, 5, 1},
+    {4, 0, 1},
+    {4, 5, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 5, 1},
+    {11, 0, 1},
+    {11, 5, 1},
+    {12, 0, 1},
+    {12, 4, 1},
+    {13, 0, 4},
+    {1, 0, 7},
+    {2, 0, 1},
+    {3, 0, 1},
+    {4, 0, 1},
+    {5, 0, 1},
+    {6, 0, 1},
+    {7, 0, 6},
+    {8, 0, 1},
+    {9, 0, 1},
+    {10, 0, 1},
+    {11, 0, 1},
+    {12, 0, 1},
+    {13, 0, 7},
+    {1, 0, 7},
+    {2, 0, 1},
+    {3, 0, 1},
+    {4, 0, 1},
+    {5, 0, 1},
+    {6, 0, 1},
+    {7, 0, 6},
+    {8, 0, 1},
+    {9, 0, 1},
+    {10, 0, 1},
+    {11, 0, 1},
+    {12, 0, 1},
+    {13, 0, 1},
+    {1, 3, 2},
+    {2, 2, 1},
+    {2, 5, 1},
+    {3, 1, 1},
+    {3, 6, 1},
+    {4, 1, 1},
+    {5, 0, 1},
+    {6, 0, 1},
+    {7, 0, 1},
+    {7, 4, 3},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 6, 1},
+    {12, 1, 2},
+    {12, 5, 2},
+    {13, 3, 2},
+    {13, 6, 1},
+    {1, 0, 1},
+    {1, 6, 1},
+    {2, 0, 1},
+    {2, 6, 1},
+    {3, 0, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 6, 1},
+    {7, 0, 7},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 0, 1},
+    {12, 6, 1},
+    {13, 0, 1},
+    {13, 6, 1},
+    {1, 2, 3},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 2, 3},
+    {1, 6, 1},
+    {2, 6, 1},
+    {3, 6, 1},
+    {4, 6, 1},
+    {5, 6, 1},
+    {6, 6, 1},
+    {7, 6, 1},
+    {8, 6, 1},
+    {9, 6, 1},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 6, 1},
+    {12, 2, 1},
+    {12, 5, 1},
+    {13, 3, 2},
+    {1, 1, 1},
+    {1, 6, 1},
+    {2, 1, 1},
+    {2, 6, 1},
+    {3, 1, 1},
+    {3, 5, 1},
+    {4, 1, 1},
+    {4, 5, 1},
+    {5, 1, 1},
+    {5, 4, 1},
+    {6, 1, 1},
+    {6, 3, 2},
+    {7, 1, 2},
+    {7, 4, 1},
+    {8, 1, 2},
+    {8, 5, 1},
+    {9, 1, 1},
+    {9, 5, 1},
+    {10, 1, 1},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 7, 1},
+    {13, 1, 1},
+    {13, 7, 1},
+    {1, 1, 1},
+    {2, 1, 1},
+    {3, 1, 1},
+    {4, 1, 1},
+    {5, 1, 1},
+    {6, 1, 1},
+    {7, 1, 1},
+    {8, 1, 1},
+    {9, 1, 1},
+    {10, 1, 1},
+    {11, 1, 1},
+    {12, 1, 1},
+    {13, 1, 6},
+    {1, 0, 1},
+    {1, 6, 1},
+    {2, 0, 1},
+    {2, 6, 1},
+    {3, 0, 2},
+    {3, 5, 2},
+    {4, 0, 2},
+    {4, 5, 2},
+    {5, 0, 2},
+    {5, 5, 2},
+    {6, 0, 1},
+    {6, 2, 1},
+    {6, 4, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 2, 1},
+    {7, 4, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 2, 1},
+    {8, 4, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 3, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 3, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 3, 1},
+    {11, 6, 1},
+    {12, 0, 1},
+    {12, 3, 1},
+    {12, 6, 1},
+    {13, 0, 1},
+    {13, 6, 1},
+    {1, 0, 1},
+    {1, 6, 1},
+    {2, 0, 2},
+    {2, 6, 1},
+    {3, 0, 2},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 2, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 2, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 3, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 3, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 3, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 4, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 4, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 5, 2},
+    {12, 0, 1},
+    {12, 5, 2},
+    {13, 0, 1},
+    {13, 6, 1},
+    {1, 2, 3},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 1, 1},
+    {3, 5, 1},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 5, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {1, 0, 5},
+    {2, 0, 1},
+    {2, 5, 1},
+    {3, 0, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 5, 1},
+    {7, 0, 5},
+    {8, 0, 1},
+    {9, 0, 1},
+    {10, 0, 1},
+    {11, 0, 1},
+    {12, 0, 1},
+    {13, 0, 1},
+    {1, 2, 3},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 1, 1},
+    {3, 5, 1},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 2, 3},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 5, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {14, 4, 1},
+    {15, 5, 2},
+    {1, 0, 5},
+    {2, 0, 1},
+    {2, 5, 1},
+    {3, 0, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 5, 1},
+    {7, 0, 5},
+    {8, 0, 1},
+    {8, 4, 1},
+    {9, 0, 1},
+    {9, 5, 1},
+    {10, 0, 1},
+    {10, 5, 1},
+    {11, 0, 1},
+    {11, 5, 1},
+    {12, 0, 1},
+    {12, 6, 1},
+    {13, 0, 1},
+    {13, 6, 1},
+    {1, 2, 3},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 0, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {6, 1, 2},
+    {7, 3, 2},
+    {8, 5, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {1, 0, 7},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {1, 0, 1},
+    {1, 6, 1},
+    {2, 0, 1},
+    {2, 6, 1},
+    {3, 0, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {1, 0, 1},
+    {1, 6, 1},
+    {2, 0, 1},
+    {2, 6, 1},
+    {3, 0, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 1, 1},
+    {5, 5, 1},
+    {6, 1, 1},
+    {6, 5, 1},
+    {7, 1, 1},
+    {7, 5, 1},
+    {8, 2, 1},
+    {8, 4, 1},
+    {9, 2, 1},
+    {9, 4, 1},
+    {10, 2, 1},
+    {10, 4, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {1, 0, 1},
+    {1, 3, 1},
+    {1, 6, 1},
+    {2, 0, 1},
+    {2, 3, 1},
+    {2, 6, 1},
+    {3, 0, 1},
+    {3, 3, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 3, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 3, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 3, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 2, 1},
+    {7, 4, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 2, 1},
+    {8, 4, 1},
+    {8, 6, 1},
+    {9, 1, 2},
+    {9, 4, 2},
+    {10, 1, 1},
+    {10, 5, 1},
+    {11, 1, 1},
+    {11, 5, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 1, 1},
+    {13, 5, 1},
+    {1, 0, 1},
+    {1, 6, 1},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 1, 1},
+    {3, 5, 1},
+    {4, 2, 1},
+    {4, 4, 1},
+    {5, 2, 1},
+    {5, 4, 1},
+    {6, 3, 1},
+    {7, 2, 1},
+    {7, 4, 1},
+    {8, 2, 1},
+    {8, 4, 1},
+    {9, 2, 1},
+    {9, 4, 1},
+    {10, 1, 1},
+    {10, 5, 1},
+    {11, 1, 1},
+    {11, 5, 1},
+    {12, 0, 1},
+    {12, 6, 1},
+    {13, 0, 1},
+    {13, 6, 1},
+    {1, 0, 1},
+    {1, 6, 1},
+    {2, 0, 1},
+    {2, 6, 1},
+    {3, 1, 1},
+    {3, 5, 1},
+    {4, 1, 1},
+    {4, 5, 1},
+    {5, 1, 1},
+    {5, 5, 1},
+    {6, 2, 1},
+    {6, 4, 1},
+    {7, 2, 1},
+    {7, 4, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {1, 0, 7},
+    {2, 5, 1},
+    {3, 5, 1},
+    {4, 4, 1},
+    {5, 4, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 2, 1},
+    {9, 2, 1},
+    {10, 1, 1},
+    {11, 1, 1},
+    {12, 0, 1},
+    {13, 0, 7},
+    {0, 3, 4},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {15, 3, 4},
+    {1, 0, 1},
+    {2, 0, 1},
+    {3, 1, 1},
+    {4, 1, 1},
+    {5, 2, 1},
+    {6, 2, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 5, 1},
+    {12, 5, 1},
+    {13, 6, 1},
+    {14, 6, 1},
+    {0, 0, 4},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {15, 0, 4},
+    {0, 3, 1},
+    {1, 2, 1},
+    {1, 4, 1},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 0, 1},
+    {3, 6, 1},
+    {14, 0, 7},
+    {0, 2, 2},
+    {1, 2, 1},
+    {2, 2, 1},
+    {3, 3, 1},
+    {5, 2, 4},
+    {6, 1, 1},
+    {6, 6, 1},
+    {7, 6, 1},
+    {8, 2, 5},
+    {9, 1, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 0, 1},
+    {12, 5, 2},
+    {13, 1, 4},
+    {13, 6, 1},
+    {1, 0, 1},
+    {2, 0, 1},
+    {3, 0, 1},
+    {4, 0, 1},
+    {5, 0, 1},
+    {5, 2, 3},
+    {6, 0, 2},
+    {6, 5, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 0, 2},
+    {12, 5, 1},
+    {13, 0, 1},
+    {13, 2, 3},
+    {5, 2, 3},
+    {6, 1, 1},
+    {6, 5, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {9, 0, 1},
+    {10, 0, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {1, 6, 1},
+    {2, 6, 1},
+    {3, 6, 1},
+    {4, 6, 1},
+    {5, 2, 3},
+    {5, 6, 1},
+    {6, 1, 1},
+    {6, 5, 2},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 2},
+    {13, 2, 3},
+    {13, 6, 1},
+    {5, 2, 3},
+    {6, 1, 1},
+    {6, 5, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 7},
+    {10, 0, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {1, 4, 2},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 1, 5},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {5, 2, 3},
+    {5, 6, 2},
+    {6, 1, 1},
+    {6, 5, 1},
+    {7, 1, 1},
+    {7, 5, 1},
+    {8, 1, 1},
+    {8, 5, 1},
+    {9, 2, 3},
+    {10, 1, 1},
+    {11, 1, 4},
+    {12, 0, 1},
+    {12, 5, 1},
+    {13, 0, 1},
+    {13, 6, 1},
+    {14, 0, 1},
+    {14, 6, 1},
+    {15, 1, 5},
+    {1, 1, 1},
+    {2, 1, 1},
+    {3, 1, 1},
+    {4, 1, 1},
+    {5, 1, 1},
+    {5, 3, 3},
+    {6, 1, 2},
+    {6, 6, 1},
+    {7, 1, 1},
+    {7, 6, 1},
+    {8, 1, 1},
+    {8, 6, 1},
+    {9, 1, 1},
+    {9, 6, 1},
+    {10, 1, 1},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 6, 1},
+    {13, 1, 1},
+    {13, 6, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {5, 2, 2},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {1, 4, 1},
+    {2, 4, 1},
+    {5, 3, 2},
+    {6, 4, 1},
+    {7, 4, 1},
+    {8, 4, 1},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 4, 1},
+    {12, 4, 1},
+    {13, 4, 1},
+    {14, 3, 1},
+    {15, 1, 2},
+    {1, 1, 1},
+    {2, 1, 1},
+    {3, 1, 1},
+    {4, 1, 1},
+    {5, 1, 1},
+    {5, 6, 1},
+    {6, 1, 1},
+    {6, 5, 1},
+    {7, 1, 1},
+    {7, 4, 1},
+    {8, 1, 1},
+    {8, 3, 1},
+    {9, 1, 2},
+    {9, 4, 1},
+    {10, 1, 1},
+    {10, 5, 1},
+    {11, 1, 1},
+    {11, 5, 1},
+    {12, 1, 1},
+    {12, 6, 1},
+    {13, 1, 1},
+    {13, 6, 1},
+    {1, 2, 2},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {5, 0, 3},
+    {5, 4, 2},
+    {6, 0, 1},
+    {6, 3, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 3, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 3, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 3, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 3, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 3, 1},
+    {11, 6, 1},
+    {12, 0, 1},
+    {12, 3, 1},
+    {12, 6, 1},
+    {13, 0, 1},
+    {13, 3, 1},
+    {13, 6, 1},
+    {5, 1, 1},
+    {5, 3, 3},
+    {6, 1, 2},
+    {6, 6, 1},
+    {7, 1, 1},
+    {7, 6, 1},
+    {8, 1, 1},
+    {8, 6, 1},
+    {9, 1, 1},
+    {9, 6, 1},
+    {10, 1, 1},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 6, 1},
+    {13, 1, 1},
+    {13, 6, 1},
+    {5, 2, 3},
+    {6, 1, 1},
+    {6, 5, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 2, 3},
+    {5, 0, 1},
+    {5, 2, 3},
+    {6, 0, 2},
+    {6, 5, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 2},
+    {11, 5, 1},
+    {12, 0, 1},
+    {12, 2, 3},
+    {13, 0, 1},
+    {14, 0, 1},
+    {15, 0, 1},
+    {5, 2, 3},
+    {5, 6, 1},
+    {6, 1, 1},
+    {6, 5, 2},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 5, 2},
+    {12, 2, 3},
+    {12, 6, 1},
+    {13, 6, 1},
+    {14, 6, 1},
+    {15, 6, 1},
+    {5, 2, 1},
+    {5, 4, 2},
+    {6, 2, 2},
+    {7, 2, 1},
+    {8, 2, 1},
+    {9, 2, 1},
+    {10, 2, 1},
+    {11, 2, 1},
+    {12, 2, 1},
+    {13, 2, 1},
+    {5, 2, 4},
+    {6, 1, 1},
+    {6, 6, 1},
+    {7, 1, 1},
+    {8, 1, 2},
+    {9, 3, 2},
+    {10, 5, 2},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 6, 1},
+    {13, 2, 4},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 1, 5},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 4, 2},
+    {5, 1, 1},
+    {5, 6, 1},
+    {6, 1, 1},
+    {6, 6, 1},
+    {7, 1, 1},
+    {7, 6, 1},
+    {8, 1, 1},
+    {8, 6, 1},
+    {9, 1, 1},
+    {9, 6, 1},
+    {10, 1, 1},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 5, 2},
+    {13, 2, 3},
+    {13, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 1, 1},
+    {8, 5, 1},
+    {9, 1, 1},
+    {9, 5, 1},
+    {10, 2, 1},
+    {10, 4, 1},
+    {11, 2, 1},
+    {11, 4, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {5, 0, 1},
+    {5, 3, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 3, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 3, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 3, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 2, 1},
+    {9, 4, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 2, 1},
+    {10, 4, 1},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 5, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 1, 1},
+    {13, 5, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 1, 1},
+    {6, 5, 1},
+    {7, 2, 1},
+    {7, 4, 1},
+    {8, 2, 1},
+    {8, 4, 1},
+    {9, 3, 1},
+    {10, 2, 1},
+    {10, 4, 1},
+    {11, 2, 1},
+    {11, 4, 1},
+    {12, 1, 1},
+    {12, 5, 1},
+    {13, 0, 1},
+    {13, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 6, 1},
+    {7, 1, 1},
+    {7, 5, 1},
+    {8, 1, 1},
+    {8, 5, 1},
+    {9, 2, 1},
+    {9, 4, 1},
+    {10, 2, 1},
+    {10, 4, 1},
+    {11, 3, 2},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 2, 1},
+    {15, 0, 2},
+    {5, 1, 6},
+    {6, 5, 1},
+    {7, 4, 1},
+    {8, 4, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 2, 1},
+    {12, 1, 1},
+    {13, 0, 7},
+    {0, 5, 1},
+    {1, 4, 1},
+    {2, 4, 1},
+    {3, 4, 1},
+    {4, 4, 1},
+    {5, 4, 1},
+    {6, 4, 1},
+    {7, 3, 1},
+    {8, 4, 1},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 4, 1},
+    {12, 4, 1},
+    {13, 4, 1},
+    {14, 4, 1},
+    {15, 5, 1},
+    {0, 3, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {15, 3, 1},
+    {0, 1, 1},
+    {1, 2, 1},
+    {2, 2, 1},
+    {3, 2, 1},
+    {4, 2, 1},
+    {5, 2, 1},
+    {6, 2, 1},
+    {7, 3, 1},
+    {8, 2, 1},
+    {9, 2, 1},
+    {10, 2, 1},
+    {11, 2, 1},
+    {12, 2, 1},
+    {13, 2, 1},
+    {14, 2, 1},
+    {15, 1, 1},
+    {3, 1, 2},
+    {4, 0, 1},
+    {4, 3, 1},
+    {4, 6, 1},
+    {5, 4, 2},
+    {11, 2, 1},
+    {12, 1, 1},
+    {12, 3, 1},
+    {13, 1, 1},
+    {13, 3, 1},
+    {14, 2, 1},
+    {1, 2, 5},
+    {2, 2, 1},
+    {3, 2, 1},
+    {4, 2, 1},
+    {5, 2, 1},
+    {6, 2, 1},
+    {7, 2, 1},
+    {8, 2, 1},
+    {9, 2, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 0, 4},
+    {12, 2, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {7, 3, 2},
+    {8, 3, 2},
+    {2, 1, 6},
+    {3, 6, 1},
+    {4, 6, 1},
+    {5, 6, 1},
+    {6, 1, 6},
+    {7, 5, 1},
+    {8, 5, 1},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 3, 1},
+    {12, 2, 1},
+    {13, 1, 1},
+    {7, 0, 6},
+    {8, 2, 1},
+    {8, 5, 1},
+    {9, 2, 1},
+    {9, 4, 1},
+    {10, 2, 2},
+    {11, 2, 1},
+    {12, 1, 1},
+    {13, 1, 1},
+    {14, 0, 1},
+    {6, 4, 1},
+    {7, 4, 1},
+    {8, 3, 1},
+    {9, 2, 2},
+    {10, 1, 1},
+    {10, 3, 1},
+    {11, 0, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {14, 3, 1},
+    {6, 2, 1},
+    {7, 2, 1},
+    {8, 0, 6},
+    {9, 0, 1},
+    {9, 5, 1},
+    {10, 0, 1},
+    {10, 5, 1},
+    {11, 0, 1},
+    {11, 4, 1},
+    {12, 4, 1},
+    {13, 3, 1},
+    {14, 2, 1},
+    {8, 1, 5},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 0, 7},
+    {6, 4, 1},
+    {7, 4, 1},
+    {8, 0, 7},
+    {9, 4, 1},
+    {10, 3, 2},
+    {11, 2, 1},
+    {11, 4, 1},
+    {12, 1, 1},
+    {12, 4, 1},
+    {13, 0, 1},
+    {13, 4, 1},
+    {14, 3, 2},
+    {6, 1, 1},
+    {7, 2, 1},
+    {8, 2, 5},
+    {9, 0, 3},
+    {9, 5, 1},
+    {10, 2, 1},
+    {10, 4, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {8, 1, 4},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 4, 1},
+    {12, 0, 7},
+    {7, 1, 5},
+    {8, 5, 1},
+    {9, 5, 1},
+    {10, 1, 5},
+    {11, 5, 1},
+    {12, 5, 1},
+    {13, 1, 5},
+    {6, 2, 1},
+    {6, 5, 1},
+    {7, 0, 1},
+    {7, 3, 1},
+    {7, 5, 1},
+    {8, 1, 1},
+    {8, 3, 1},
+    {8, 5, 1},
+    {9, 1, 1},
+    {9, 5, 1},
+    {10, 4, 1},
+    {11, 4, 1},
+    {12, 3, 1},
+    {13, 2, 1},
+    {6, 2, 4},
+    {2, 0, 7},
+    {3, 6, 1},
+    {4, 3, 1},
+    {4, 6, 1},
+    {5, 3, 1},
+    {5, 6, 1},
+    {6, 3, 1},
+    {6, 5, 1},
+    {7, 3, 2},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 2, 1},
+    {11, 2, 1},
+    {12, 1, 1},
+    {13, 0, 1},
+    {1, 6, 1},
+    {2, 6, 1},
+    {3, 5, 1},
+    {4, 5, 1},
+    {5, 4, 1},
+    {6, 3, 2},
+    {7, 2, 1},
+    {7, 4, 1},
+    {8, 1, 1},
+    {8, 4, 1},
+    {9, 0, 1},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 4, 1},
+    {12, 4, 1},
+    {13, 4, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 0, 7},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 5, 1},
+    {10, 5, 1},
+    {11, 4, 1},
+    {12, 3, 1},
+    {13, 2, 1},
+    {3, 0, 7},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 1},
+    {8, 3, 1},
+    {9, 3, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 0, 8},
+    {1, 4, 1},
+    {2, 4, 1},
+    {3, 4, 1},
+    {4, 0, 7},
+    {5, 4, 1},
+    {6, 3, 2},
+    {7, 3, 2},
+    {8, 2, 1},
+    {8, 4, 1},
+    {9, 2, 1},
+    {9, 4, 1},
+    {10, 1, 1},
+    {10, 4, 1},
+    {11, 0, 1},
+    {11, 4, 1},
+    {12, 4, 1},
+    {13, 3, 2},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 0, 7},
+    {5, 3, 1},
+    {5, 6, 1},
+    {6, 3, 1},
+    {6, 6, 1},
+    {7, 3, 1},
+    {7, 6, 1},
+    {8, 3, 1},
+    {8, 6, 1},
+    {9, 2, 1},
+    {9, 6, 1},
+    {10, 2, 1},
+    {10, 6, 1},
+    {11, 2, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 6, 1},
+    {13, 0, 1},
+    {13, 4, 2},
+    {1, 2, 1},
+    {2, 2, 1},
+    {3, 2, 4},
+    {4, 0, 3},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 3, 4},
+    {8, 0, 4},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 4, 1},
+    {12, 4, 1},
+    {13, 4, 1},
+    {1, 2, 1},
+    {2, 2, 1},
+    {3, 2, 5},
+    {4, 2, 1},
+    {4, 6, 1},
+    {5, 2, 1},
+    {5, 6, 1},
+    {6, 1, 1},
+    {6, 6, 1},
+    {7, 1, 1},
+    {7, 5, 1},
+    {8, 0, 1},
+    {8, 5, 1},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 3, 1},
+    {12, 2, 1},
+    {13, 1, 1},
+    {1, 1, 1},
+    {2, 1, 1},
+    {3, 1, 1},
+    {4, 1, 6},
+    {5, 1, 1},
+    {5, 4, 1},
+    {6, 1, 1},
+    {6, 4, 1},
+    {7, 1, 1},
+    {7, 4, 1},
+    {8, 0, 1},
+    {8, 4, 1},
+    {9, 4, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 2, 1},
+    {13, 1, 1},
+    {3, 0, 7},
+    {4, 6, 1},
+    {5, 6, 1},
+    {6, 6, 1},
+    {7, 6, 1},
+    {8, 6, 1},
+    {9, 6, 1},
+    {10, 6, 1},
+    {11, 0, 7},
+    {12, 6, 1},
+    {1, 2, 1},
+    {1, 5, 1},
+    {2, 2, 1},
+    {2, 5, 1},
+    {3, 2, 1},
+    {3, 5, 1},
+    {4, 2, 1},
+    {4, 5, 1},
+    {5, 0, 7},
+    {6, 2, 1},
+    {6, 5, 1},
+    {7, 2, 1},
+    {7, 5, 1},
+    {8, 2, 1},
+    {8, 5, 1},
+    {9, 2, 1},
+    {9, 5, 1},
+    {10, 5, 1},
+    {11, 4, 1},
+    {12, 3, 1},
+    {13, 2, 1},
+    {2, 1, 2},
+    {3, 3, 1},
+    {6, 0, 2},
+    {6, 6, 1},
+    {7, 2, 1},
+    {7, 6, 1},
+    {8, 5, 1},
+    {9, 5, 1},
+    {10, 4, 1},
+    {11, 3, 1},
+    {12, 2, 1},
+    {13, 0, 2},
+    {3, 0, 7},
+    {4, 5, 1},
+    {5, 5, 1},
+    {6, 5, 1},
+    {7, 4, 1},
+    {8, 4, 1},
+    {9, 3, 2},
+    {10, 3, 1},
+    {10, 5, 1},
+    {11, 2, 1},
+    {11, 5, 1},
+    {12, 1, 1},
+    {12, 6, 1},
+    {13, 0, 1},
+    {13, 6, 1},
+    {1, 1, 1},
+    {2, 1, 1},
+    {3, 1, 1},
+    {4, 1, 1},
+    {5, 1, 1},
+    {5, 4, 3},
+    {6, 1, 3},
+    {6, 6, 1},
+    {7, 0, 2},
+    {7, 5, 1},
+    {8, 1, 1},
+    {8, 4, 1},
+    {9, 1, 1},
+    {10, 1, 1},
+    {11, 1, 1},
+    {12, 1, 1},
+    {13, 2, 5},
+    {2, 6, 1},
+    {3, 0, 1},
+    {3, 6, 1},
+    {4, 1, 1},
+    {4, 6, 1},
+    {5, 1, 1},
+    {5, 6, 1},
+    {6, 1, 1},
+    {6, 6, 1},
+    {7, 5, 1},
+    {8, 5, 1},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 3, 1},
+    {12, 2, 1},
+    {13, 1, 1},
+    {1, 2, 1},
+    {2, 2, 1},
+    {3, 2, 5},
+    {4, 2, 1},
+    {4, 6, 1},
+    {5, 1, 1},
+    {5, 6, 1},
+    {6, 1, 2},
+    {6, 6, 1},
+    {7, 1, 1},
+    {7, 3, 1},
+    {7, 5, 1},
+    {8, 0, 1},
+    {8, 4, 2},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 3, 1},
+    {12, 2, 1},
+    {13, 1, 1},
+    {1, 6, 1},
+    {2, 4, 2},
+    {3, 1, 4},
+    {4, 4, 1},
+    {5, 4, 1},
+    {6, 0, 8},
+    {7, 4, 1},
+    {8, 4, 1},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 3, 1},
+    {12, 2, 1},
+    {13, 1, 1},
+    {2, 2, 1},
+    {3, 2, 1},
+    {3, 6, 1},
+    {4, 0, 1},
+    {4, 3, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 3, 1},
+    {5, 6, 1},
+    {6, 1, 1},
+    {6, 6, 1},
+    {7, 1, 1},
+    {7, 5, 1},
+    {8, 5, 1},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 3, 1},
+    {12, 2, 1},
+    {13, 1, 1},
+    {2, 1, 6},
+    {6, 0, 7},
+    {7, 4, 1},
+    {8, 4, 1},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 3, 1},
+    {12, 2, 1},
+    {13, 1, 1},
+    {1, 2, 1},
+    {2, 2, 1},
+    {3, 2, 1},
+    {4, 2, 1},
+    {5, 2, 2},
+    {6, 2, 1},
+    {6, 4, 1},
+    {7, 2, 1},
+    {7, 5, 1},
+    {8, 2, 1},
+    {8, 6, 1},
+    {9, 2, 1},
+    {9, 6, 1},
+    {10, 2, 1},
+    {11, 2, 1},
+    {12, 2, 1},
+    {13, 2, 1},
+    {1, 4, 1},
+    {2, 4, 1},
+    {3, 4, 1},
+    {4, 0, 7},
+    {5, 4, 1},
+    {6, 4, 1},
+    {7, 4, 1},
+    {8, 4, 1},
+    {9, 4, 1},
+    {10, 3, 1},
+    {11, 3, 1},
+    {12, 2, 1},
+    {13, 1, 1},
+    {3, 1, 5},
+    {11, 0, 8},
+    {2, 1, 6},
+    {3, 6, 1},
+    {4, 6, 1},
+    {5, 2, 1},
+    {5, 5, 1},
+    {6, 3, 1},
+    {6, 5, 1},
+    {7, 4, 1},
+    {8, 4, 2},
+    {9, 3, 1},
+    {9, 5, 1},
+    {10, 3, 1},
+    {10, 6, 1},
+    {11, 2, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {13, 0, 1},
+    {0, 3, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 0, 7},
+    {4, 5, 1},
+    {5, 5, 1},
+    {6, 4, 1},
+    {7, 3, 2},
+    {8, 2, 2},
+    {8, 5, 1},
+    {9, 1, 1},
+    {9, 3, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 3, 1},
+    {10, 6, 1},
+    {11, 3, 1},
+    {12, 3, 1},
+    {13, 3, 1},
+    {1, 6, 1},
+    {2, 6, 1},
+    {3, 6, 1},
+    {4, 5, 1},
+    {5, 5, 1},
+    {6, 5, 1},
+    {7, 4, 1},
+    {8, 4, 1},
+    {9, 3, 1},
+    {10, 2, 1},
+    {11, 1, 1},
+    {12, 0, 1},
+    {2, 4, 1},
+    {3, 4, 1},
+    {4, 2, 1},
+    {4, 5, 1},
+    {5, 2, 1},
+    {5, 5, 1},
+    {6, 2, 1},
+    {6, 5, 1},
+    {7, 2, 1},
+    {7, 6, 1},
+    {8, 2, 1},
+    {8, 6, 1},
+    {9, 2, 1},
+    {9, 6, 1},
+    {10, 2, 1},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 6, 1},
+    {12, 1, 1},
+    {12, 6, 1},
+    {13, 0, 1},
+    {13, 6, 1},
+    {1, 1, 1},
+    {2, 1, 1},
+    {3, 1, 1},
+    {4, 1, 1},
+    {4, 6, 1},
+    {5, 1, 1},
+    {5, 4, 2},
+    {6, 1, 3},
+    {7, 1, 1},
+    {8, 1, 1},
+    {9, 1, 1},
+    {10, 1, 1},
+    {11, 1, 1},
+    {12, 1, 1},
+    {13, 2, 5},
+    {2, 0, 7},
+    {3, 6, 1},
+    {4, 6, 1},
+    {5, 6, 1},
+    {6, 6, 1},
+    {7, 5, 1},
+    {8, 5, 1},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 3, 1},
+    {12, 2, 1},
+    {13, 1, 1},
+    {2, 2, 1},
+    {3, 2, 1},
+    {4, 1, 1},
+    {4, 3, 1},
+    {5, 1, 1},
+    {5, 3, 1},
+    {6, 0, 1},
+    {6, 4, 1},
+    {7, 0, 1},
+    {7, 4, 1},
+    {8, 5, 1},
+    {9, 6, 1},
+    {10, 7, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 0, 7},
+    {5, 3, 1},
+    {6, 3, 2},
+    {7, 1, 1},
+    {7, 3, 1},
+    {7, 5, 1},
+    {8, 1, 1},
+    {8, 3, 1},
+    {8, 5, 1},
+    {9, 1, 1},
+    {9, 3, 1},
+    {9, 6, 1},
+    {10, 1, 1},
+    {10, 3, 1},
+    {10, 6, 1},
+    {11, 0, 1},
+    {11, 3, 1},
+    {11, 6, 1},
+    {12, 3, 1},
+    {13, 2, 2},
+    {3, 0, 7},
+    {4, 6, 1},
+    {5, 6, 1},
+    {6, 5, 1},
+    {7, 5, 1},
+    {8, 0, 2},
+    {8, 4, 1},
+    {9, 2, 2},
+    {10, 3, 1},
+    {11, 4, 1},
+    {12, 5, 1},
+    {13, 5, 1},
+    {1, 1, 2},
+    {2, 3, 2},
+    {3, 5, 1},
+    {6, 1, 2},
+    {7, 3, 2},
+    {8, 5, 1},
+    {10, 0, 3},
+    {11, 3, 2},
+    {12, 5, 1},
+    {13, 6, 1},
+    {1, 3, 1},
+    {2, 3, 1},
+    {3, 3, 1},
+    {4, 3, 1},
+    {5, 3, 1},
+    {6, 3, 1},
+    {7, 2, 1},
+    {7, 4, 1},
+    {8, 2, 1},
+    {8, 5, 1},
+    {9, 2, 1},
+    {9, 5, 1},
+    {10, 2, 1},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 4, 3},
+    {12, 0, 4},
+    {12, 6, 1},
+    {13, 6, 1},
+    {1, 5, 1},
+    {2, 5, 1},
+    {3, 5, 1},
+    {4, 5, 1},
+    {5, 1, 2},
+    {5, 5, 1},
+    {6, 3, 2},
+    {7, 4, 1},
+    {8, 4, 2},
+    {9, 3, 1},
+    {9, 6, 1},
+    {10, 3, 1},
+    {11, 2, 1},
+    {12, 1, 1},
+    {13, 0, 1},
+    {2, 0, 7},
+    {3, 2, 1},
+    {4, 2, 1},
+    {5, 2, 1},
+    {6, 0, 7},
+    {7, 2, 1},
+    {8, 2, 1},
+    {9, 2, 1},
+    {10, 2, 1},
+    {11, 2, 1},
+    {12, 3, 4},
+    {1, 2, 1},
+    {2, 2, 1},
+    {3, 2, 1},
+    {4, 3, 1},
+    {4, 5, 3},
+    {5, 2, 3},
+    {5, 7, 1},
+    {6, 0, 2},
+    {6, 3, 1},
+    {6, 6, 1},
+    {7, 3, 1},
+    {7, 6, 1},
+    {8, 4, 2},
+    {9, 4, 1},
+    {10, 4, 1},
+    {11, 5, 1},
+    {12, 5, 1},
+    {13, 5, 1},
+    {4, 1, 5},
+    {5, 5, 1},
+    {6, 5, 1},
+    {7, 5, 1},
+    {8, 5, 1},
+    {9, 5, 1},
+    {10, 5, 1},
+    {11, 5, 1},
+    {12, 0, 8},
+    {2, 0, 7},
+    {3, 6, 1},
+    {4, 6, 1},
+    {5, 6, 1},
+    {6, 6, 1},
+    {7, 1, 6},
+    {8, 6, 1},
+    {9, 6, 1},
+    {10, 6, 1},
+    {11, 6, 1},
+    {12, 6, 1},
+    {13, 0, 7},
+    {2, 1, 5},
+    {6, 0, 7},
+    {7, 6, 1},
+    {8, 6, 1},
+    {9, 5, 1},
+    {10, 5, 1},
+    {11, 4, 1},
+    {12, 3, 1},
+    {13, 1, 2},
+    {1, 5, 1},
+    {2, 1, 1},
+    {2, 5, 1},
+    {3, 1, 1},
+    {3, 5, 1},
+    {4, 1, 1},
+    {4, 5, 1},
+    {5, 1, 1},
+    {5, 5, 1},
+    {6, 1, 1},
+    {6, 5, 1},
+    {7, 1, 1},
+    {7, 5, 1},
+    {8, 1, 1},
+    {8, 5, 1},
+    {9, 5, 1},
+    {10, 4, 1},
+    {11, 4, 1},
+    {12, 3, 1},
+    {13, 2, 1},
+    {1, 4, 1},
+    {2, 4, 1},
+    {3, 2, 1},
+    {3, 4, 1},
+    {4, 2, 1},
+    {4, 4, 1},
+    {5, 2, 1},
+    {5, 4, 1},
+    {6, 2, 1},
+    {6, 4, 1},
+    {7, 2, 1},
+    {7, 4, 1},
+    {7, 7, 1},
+    {8, 2, 1},
+    {8, 4, 1},
+    {8, 7, 1},
+    {9, 2, 1},
+    {9, 4, 1},
+    {9, 6, 1},
+    {10, 1, 1},
+    {10, 4, 1},
+    {10, 6, 1},
+    {11, 1, 1},
+    {11, 4, 2},
+    {12, 1, 1},
+    {12, 4, 1},
+    {13, 0, 1},
+    {2, 1, 1},
+    {3, 1, 1},
+    {4, 1, 1},
+    {5, 1, 1},
+    {6, 1, 1},
+    {7, 1, 1},
+    {8, 1, 1},
+    {8, 6, 1},
+    {9, 1, 1},
+    {9, 5, 1},
+    {10, 1, 1},
+    {10, 5, 1},
+    {11, 1, 1},
+    {11, 4, 1},
+    {12, 1, 1},
+    {12, 3, 1},
+    {13, 1, 2},
+    {3, 0, 7},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 0, 1},
+    {8, 6, 1},
+    {9, 0, 1},
+    {9, 6, 1},
+    {10, 0, 1},
+    {10, 6, 1},
+    {11, 0, 7},
+    {12, 0, 1},
+    {12, 6, 1},
+    {3, 0, 7},
+    {4, 0, 1},
+    {4, 6, 1},
+    {5, 0, 1},
+    {5, 6, 1},
+    {6, 0, 1},
+    {6, 6, 1},
+    {7, 0, 1},
+    {7, 6, 1},
+    {8, 6, 1},
+    {9, 5, 1},
+    {10, 5, 1},
+    {11, 4, 1},
+    {12, 3, 1},
+    {13, 2, 1},
+    {3, 0, 2},
+    {4, 2, 1},
+    {5, 6, 1},
+    {6, 6, 1},
+    {7, 6, 1},
+    {8, 5, 1},
+    {9, 5, 1},
+    {10, 4, 1},
+    {11, 3, 1},
+    {12, 2, 1},
+    {13, 0, 2},
+    {1, 0, 1},
+    {1, 3, 1},
+    {2, 1, 1},
+    {2, 4, 1},
+    {3, 1, 1},
+    {3, 4, 1},
+    {1, 1, 2},
+    {2, 0, 1},
+    {2, 3, 1},
+    {3, 0, 1},
+    {3, 3, 1},
+    {4, 1, 2},
+  },
+};
\ No newline at end of file
@@ -0,0 +1,211 @@
+#include "input_record.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#include "asmfunc.h"
+#include "fat.hpp"
+#include "layer.hpp"
+#include "logger.hpp"
+#include "serial.hpp"
+
+namespace {
+  const char kMagic[8] = "MKINPUT";
+  const uint32_t kVersion = 1;
+}
+
+InputRecorder::InputRecorder(std::function<usb::HIDMouseDriver::ObserverType> mouse_observer,
+                             std::function<usb::HIDKeyboardDriver::ObserverType> keyboard_observer)
+  : mouse_observer_{mouse_observer}, keyboard_observer_{keyboard_observer} {
+}
+
+void InputRecorder::OnMouse(uint8_t buttons, int8_t displacement_x, int8_t displacement_y) {
+  if(recording_) {
+    Append(InputEvent::kMouse, buttons,
+           static_cast<uint8_t>(displacement_x), static_cast<uint8_t>(displacement_y));
+  }
+  mouse_observer_(buttons, displacement_x, displacement_y);
+}
+
+void InputRecorder::OnKey(uint8_t modifier, uint8_t keycode) {
+  if(recording_) {
+    Append(InputEvent::kKey, modifier, keycode, 0);
+  }
+  keyboard_observer_(modifier, keycode);
+}
+
+void InputRecorder::StartRecording() {
+  MutexGuard lock{mutex_};
+  replaying_ = false;
+  events_.clear();
+  dropped_ = 0;
+  record_start_tsc_ = ReadTSC();
+  recording_ = true;
+}
+
+void InputRecorder::StopRecording() {
+  MutexGuard lock{mutex_};
+  recording_ = false;
+}
+
+Error InputRecorder::StartReplay(unsigned int speed) {
+  MutexGuard lock{mutex_};
+  if(events_.empty()) {
+    return MAKE_ERROR(Error::kEmpty);
+  }
+
+  recording_ = false;
+  replay_speed_ = speed;
+  replay_index_ = 0;
+  replay_elapsed_us_ = 0;
+  // 再生中の合成の回数と時間を capture で取れるようにする
+  layer_manager->ResetDrawStatistics();
+  replay_start_tsc_ = ReadTSC();
+
+  if(!replaying_) {
+    replaying_ = true;
+    timer_manager->AddTimer(Timer{timer_manager->CurrentTick() + 1, kInputReplayTimerValue});
+  }
+  return MAKE_ERROR(Error::kSuccess);
+}
+
+void InputRecorder::OnReplayTimer() {
+  MutexGuard lock{mutex_};
+  if(!replaying_) {
+    return;
+  }
+
+  const uint64_t elapsed_us = TSCToMicroseconds(ReadTSC() - replay_start_tsc_);
+  while(replay_index_ < events_.size()) {
+    const auto& event = events_[replay_index_];
+    if(replay_speed_ != 0 && event.time_us > elapsed_us * replay_speed_) {
+      break;
+    }
+    Inject(event);
+    ++replay_index_;
+  }
+
+  if(replay_index_ < events_.size()) {
+    timer_manager->AddTimer(Timer{timer_manager->CurrentTick() + 1, kInputReplayTimerValue});
+  } else {
+    FinishReplay();
+  }
+}
+
+Error InputRecorder::Save() {
+  if(!SerialAvailable()) {
+    return MAKE_ERROR(Error::kNoSerialPort);
+  }
+
+  MutexGuard lock{mutex_};
+  InputRecordHeader header;
+  memcpy(header.magic, kMagic, sizeof(header.magic));
+  header.version = kVersion;
+  header.num_events = events_.size();
+
+  char s[64];
+  sprintf(s, "@@INPUT bytes=%lu\n", sizeof(header) + events_.size() * sizeof(InputEvent));
+  SerialWrite(s);
+  SerialWrite(&header, sizeof(header));
+  SerialWrite(events_.data(), events_.size() * sizeof(InputEvent));
+  SerialWrite("\n@@END\n");
+  SerialFlush();
+  return MAKE_ERROR(Error::kSuccess);
+}
+
+Error InputRecorder::Load(const char* name) {
+  auto entry = fat::FindFile(name);
+  if(!entry) {
+    return MAKE_ERROR(Error::kNoSuchFile);
+  }
+
+  const size_t size = entry->file_size;
+  if(size < sizeof(InputRecordHeader)) {
+    return MAKE_ERROR(Error::kInvalidFormat);
+  }
+
+  std::vector<uint8_t> buf(size);
+  if(fat::LoadFile(buf.data(), size, *entry) != size) {
+    return MAKE_ERROR(Error::kInvalidFormat);
+  }
+
+  InputRecordHeader header;
+  memcpy(&header, buf.data(), sizeof(header));
+  if(memcmp(header.magic, kMagic, sizeof(header.magic)) != 0 ||
+     header.version != kVersion ||
+     header.num_events > kMaxEvents ||
+     size < sizeof(header) + header.num_events * sizeof(InputEvent)) {
+    return MAKE_ERROR(Error::kInvalidFormat);
+  }
+
+  MutexGuard lock{mutex_};
+  recording_ = false;
+  replaying_ = false;
+  events_.resize(header.num_events);
+  memcpy(events_.data(), buf.data() + sizeof(header), header.num_events * sizeof(InputEvent));
+  dropped_ = 0;
+  return MAKE_ERROR(Error::kSuccess);
+}
+
+void InputRecorder::Append(InputEvent::Type type, uint8_t a0, uint8_t a1, uint8_t a2) {
+  MutexGuard lock{mutex_};
+  if(!recording_) {
+    return;
+  }
+  if(events_.size() >= kMaxEvents) {
+    ++dropped_;
+    return;
+  }
+
+  InputEvent event{};
+  event.time_us = TSCToMicroseconds(ReadTSC() - record_start_tsc_);
+  event.type = type;
+  event.arg[0] = a0;
+  event.arg[1] = a1;
+  event.arg[2] = a2;
+  events_.push_back(event);
+}
+
+void InputRecorder::Inject(const InputEvent& event) {
+  switch(event.type) {
+    case InputEvent::kMouse:
+      mouse_observer_(event.arg[0],
+                      static_cast<int8_t>(event.arg[1]), static_cast<int8_t>(event.arg[2]));
+      break;
+    case InputEvent::kKey:
+      keyboard_observer_(event.arg[0], event.arg[1]);
+      break;
+  }
+}
+
+void InputRecorder::FinishReplay() {
+  replaying_ = false;
+  replay_elapsed_us_ = TSCToMicroseconds(ReadTSC() - replay_start_tsc_);
+
+  Log(kDebug, "input replay: %lu events in %lu us (speed %u)\n",
+      events_.size(), replay_elapsed_us_, replay_speed_);
+
+  // tools/capture_test.py が再生の終わりを待てるように知らせる
+  char s[64];
+  sprintf(s, "@@REPLAY events=%lu elapsed_us=%lu\n", events_.size(), replay_elapsed_us_);
+  SerialWrite(s);
+  SerialFlush();
+}
+
+void InitializeInputRecorder() {
+  input_recorder = new InputRecorder{
+    usb::HIDMouseDriver::default_observer,
+    usb::HIDKeyboardDriver::default_observer
+  };
+
+  // USB デバイスは設定されるときに default_observer を登録するので、
+  // ここで差し替えれば実際の入力はすべて記録器を通る
+  usb::HIDMouseDriver::default_observer =
+    [](uint8_t buttons, int8_t displacement_x, int8_t displacement_y) {
+      input_recorder->OnMouse(buttons, displacement_x, displacement_y);
+    };
+  usb::HIDKeyboardDriver::default_observer =
+    [](uint8_t modifier, uint8_t keycode) {
+      input_recorder->OnKey(modifier, keycode);
+    };
+}
\ No newline at end of file
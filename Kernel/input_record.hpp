@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "error.hpp"
+#include "sync.hpp"
+#include "timer.hpp"
+#include "usb/classdriver/keyboard.hpp"
+#include "usb/classdriver/mouse.hpp"
+
+const int kInputReplayTimerValue = kTaskTimerValue + 2;
+
+// 記録した入力イベント 1 つ。ファイルやシリアルにはこの形のまま並べる
+struct InputEvent {
+  enum Type : uint8_t {
+    kMouse,
+    kKey,
+  };
+
+  uint64_t time_us; // 記録を始めてからの時間
+  Type type;
+  uint8_t arg[3];   // kMouse: buttons, dx, dy / kKey: modifier, keycode
+  uint32_t reserved;
+} __attribute__((packed));
+
+// 記録ファイルの先頭
+struct InputRecordHeader {
+  char magic[8];    // "MKINPUT"
+  uint32_t version;
+  uint32_t num_events;
+} __attribute__((packed));
+
+// マウスとキーボードの observer の間に入って入力を記録し、
+// 記録した入力を同じ observer へ流し込んで再生する
+class InputRecorder {
+  public:
+    static const size_t kMaxEvents = 65536;
+
+    InputRecorder(std::function<usb::HIDMouseDriver::ObserverType> mouse_observer,
+                  std::function<usb::HIDKeyboardDriver::ObserverType> keyboard_observer);
+
+    void OnMouse(uint8_t buttons, int8_t displacement_x, int8_t displacement_y);
+    void OnKey(uint8_t modifier, uint8_t keycode);
+
+    void StartRecording();
+    void StopRecording();
+
+    // speed 倍の速さで再生する。speed が 0 なら待たずにすべて流し込む
+    Error StartReplay(unsigned int speed);
+    // kInputReplayTimerValue のタイマでメインタスクから呼ぶ
+    void OnReplayTimer();
+
+    // 記録を @@INPUT bytes=N <記録ファイル> @@END の形でシリアルポートへ送る
+    Error Save();
+    // 記録ファイルを FAT ボリュームから読み込む
+    Error Load(const char* name);
+
+    bool Recording() const { return recording_; }
+    bool Replaying() const { return replaying_; }
+    size_t NumEvents() const { return events_.size(); }
+    size_t DroppedEvents() const { return dropped_; }
+    size_t ReplayedEvents() const { return replay_index_; }
+    uint64_t ReplayElapsedMicroseconds() const { return replay_elapsed_us_; }
+
+  private:
+    std::function<usb::HIDMouseDriver::ObserverType> mouse_observer_;
+    std::function<usb::HIDKeyboardDriver::ObserverType> keyboard_observer_;
+
+    Mutex mutex_;
+    std::vector<InputEvent> events_;
+    size_t dropped_{0};
+    bool recording_{false};
+    uint64_t record_start_tsc_{0};
+
+    bool replaying_{false};
+    unsigned int replay_speed_{1};
+    size_t replay_index_{0};
+    uint64_t replay_start_tsc_{0};
+    uint64_t replay_elapsed_us_{0};
+
+    void Append(InputEvent::Type type, uint8_t a0, uint8_t a1, uint8_t a2);
+    void Inject(const InputEvent& event);
+    void FinishReplay();
+};
+
+inline InputRecorder* input_recorder;
+
+// InitializeMouse と InitializeKeyboard の後に呼ぶ
+void InitializeInputRecorder();
\ No newline at end of file
@@ -122,6 +122,47 @@ void IntHandlerXHCI(InterruptFrame* frame) {
   NotifyEndOfInterrupt();
 }
 
+void InterruptOffTracker::End() {
+  if(start_ == 0) {
+    return;
+  }
+
+  const auto duration = ReadTSC() - start_;
+  start_ = 0;
+
+  const int bucket = duration == 0 ? 0 : 64 - __builtin_clzll(duration);
+  histogram_[std::min(bucket, kBuckets - 1)]++;
+
+  if(duration > max_) {
+    max_ = duration;
+    max_site_ = {file_, line_, 1, duration};
+  }
+
+  // 呼び出し元ごとの最大値。表が埋まっていたら最大値が最も小さいものと入れ替える
+  Site* min_site = &sites_[0];
+  for(auto& site : sites_) {
+    if(site.file == file_ && site.line == line_) {
+      site.count++;
+      site.max = std::max(site.max, duration);
+      return;
+    }
+    if(site.max < min_site->max) {
+      min_site = &site;
+    }
+  }
+
+  if(min_site->max < duration) {
+    *min_site = {file_, line_, 1, duration};
+  }
+}
+
+void InterruptOffTracker::Reset() {
+  max_ = 0;
+  max_site_ = {};
+  histogram_.fill(0);
+  sites_.fill({});
+}
+
 void InitializeInterrupt() {  
   const uint16_t cs = GetCS();
 
@@ -7,6 +7,7 @@
 #include "message.hpp"
 #include "logger.hpp"
 #include "x86_descriptor.hpp"
+#include "asmfunc.h"
 
 class InterruptVector {
   public:
@@ -65,4 +66,73 @@ struct InterruptFrame {
 
 void InitializeInterrupt();
 
+// 割り込み禁止区間の長さをTSCで計測し、最大値とヒストグラムを記録する。
+// 禁止したまま別タスクに切り替わった場合は、割り込みが再び許可されるまでを1区間とする
+class InterruptOffTracker {
+  public:
+    static const int kBuckets = 32;
+    static const int kSites = 16;
+
+    struct Site {
+      const char* file{nullptr};
+      int line{0};
+      uint64_t count{0};
+      uint64_t max{0};
+    };
+
+    // 割り込みを禁止した直後に呼ぶ
+    void Begin(const char* file, int line) {
+      start_ = ReadTSC();
+      file_ = file;
+      line_ = line;
+    }
+    // 割り込みを許可する直前に呼ぶ
+    void End();
+    void Reset();
+
+    uint64_t Max() const { return max_; }
+    const Site& MaxSite() const { return max_site_; }
+    const std::array<uint64_t, kBuckets>& Histogram() const { return histogram_; }
+    const std::array<Site, kSites>& Sites() const { return sites_; }
+
+  private:
+    uint64_t start_{0};
+    const char* file_{nullptr};
+    int line_{0};
+
+    uint64_t max_{0};
+    Site max_site_{};
+    // histogram_[i] は長さが [2^(i-1), 2^i) TSCカウントの区間の数
+    std::array<uint64_t, kBuckets> histogram_{};
+    std::array<Site, kSites> sites_{};
+};
+
+inline InterruptOffTracker interrupt_off_tracker;
+
+// スコープの間だけ割り込みを禁止する。
+// 生成時点で割り込みが禁止されていた場合は破棄時にも禁止されたままにする。
+// 禁止した区間は呼び出し元のファイルと行番号とともに interrupt_off_tracker に記録する
+class InterruptGuard {
+  public:
+    InterruptGuard(const char* file = __builtin_FILE(), int line = __builtin_LINE()) {
+      uint64_t rflags;
+      __asm__ volatile("pushfq\n\tpopq %0\n\tcli" : "=r"(rflags) : : "memory");
+      enabled_ = (rflags & 0x200) != 0;
+      if(enabled_) {
+        interrupt_off_tracker.Begin(file, line);
+      }
+    }
+    ~InterruptGuard() {
+      if(enabled_) {
+        interrupt_off_tracker.End();
+        __asm__ volatile("sti" : : : "memory");
+      }
+    }
+    InterruptGuard(const InterruptGuard&) = delete;
+    InterruptGuard& operator=(const InterruptGuard&) = delete;
+
+  private:
+    bool enabled_;
+};
+
 const int kISTForTimer = 1;
\ No newline at end of file
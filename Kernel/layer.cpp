@@ -1,10 +1,13 @@
 #include <memory>
 #include <algorithm>
+#include <iterator>
+#include <limits>
 
 #include "layer.hpp"
 #include "console.hpp"
 #include "logger.hpp"
 #include "message.hpp"
+#include "asmfunc.h"
 
 namespace { 
   FrameBuffer* screen;
@@ -29,11 +32,20 @@ Layer& Layer::MoveRelative(Vector2D<int> pos_diff) {
 void Layer::DrawTo(FrameBuffer& screen, const Rectangle<int>& area) {
   if(window_) {
     window_->DrawTo(screen, pos_, area);
+  } else if(content_) {
+    content_->DrawTo(screen, pos_, area);
   }
 }
 
 Layer& Layer::SetWindow(const std::shared_ptr<Window>& window) {
   window_ = window;
+  content_.reset();
+  return *this;
+}
+
+Layer& Layer::SetContent(const std::shared_ptr<LayerContent>& content) {
+  content_ = content;
+  window_.reset();
   return *this;
 }
 
@@ -45,6 +57,30 @@ Vector2D<int> Layer::GetPosition() const {
   return pos_;
 }
 
+Rectangle<int> Layer::GetArea() const {
+  if(window_) {
+    return {pos_, window_->Size()};
+  } else if(content_) {
+    return {pos_, content_->Size()};
+  }
+  return {pos_, {0, 0}};
+}
+
+bool Layer::IsOpaque() const {
+  const auto area = OpaqueArea();
+  return !IsEmpty(area) && area.size.x == GetArea().size.x && area.size.y == GetArea().size.y;
+}
+
+Rectangle<int> Layer::OpaqueArea() const {
+  Rectangle<int> area{{0, 0}, {0, 0}};
+  if(window_) {
+    area = window_->OpaqueArea();
+  } else if(content_) {
+    area = content_->OpaqueArea();
+  }
+  return {pos_ + area.pos, area.size};
+}
+
 Layer& Layer::SetDraggable(bool draggable) {
   draggable_ = draggable;
   return *this;
@@ -59,39 +95,52 @@ void LayerManager::SetWriter(FrameBuffer* screen) {
 
   FrameBufferConfig back_config = screen->Config();
   back_config.frame_buffer = nullptr;
+  back_config.pixel_format = window_pixel_format;
   back_buffer_.Initialize(back_config);
+
+  const auto size = ScreenSize();
+  grid_size_ = {(size.x + kTileSize - 1) / kTileSize, (size.y + kTileSize - 1) / kTileSize};
+  tiles_.resize(grid_size_.x * grid_size_.y);
 }
 
 Layer& LayerManager::NewLayer() {
+  MutexGuard lock{mutex_};
   latest_id_++;
-  return *layers_.emplace_back(new Layer{latest_id_});
+  auto& layer = *layers_.emplace_back(new Layer{latest_id_});
+  layer_by_id_[latest_id_] = &layer;
+  return layer;
 }
 
 Layer* LayerManager::FindLayer(unsigned int id) {
-  auto pred = [id](const std::unique_ptr<Layer>&elem) {
-    return elem->ID() == id;
-  };
-
-  auto it = std::find_if(layers_.begin(), layers_.end(), pred);
-  if(it == layers_.end()) {
+  MutexGuard lock{mutex_};
+  auto it = layer_by_id_.find(id);
+  if(it == layer_by_id_.end()) {
     return nullptr;
   }
 
-  return it->get();
+  return it->second;
 }
 
 void LayerManager::Move(unsigned int id, Vector2D<int> new_position) {
+  MutexGuard lock{mutex_};
   auto layer = FindLayer(id);
   if(layer != nullptr) {
-    const auto window_size = layer->GetWindow()->Size();
-    const auto old_pos = layer->GetPosition();    
+    const auto old_area = layer->GetArea();
+    const bool shown = heights_.count(layer) > 0;
+    if(shown) {
+      UnindexLayer(layer);
+    }
     layer->Move(new_position);
-    Draw({old_pos, window_size});
-    Draw(id);
+    if(shown) {
+      IndexLayer(layer);
+    }
+    Invalidate(old_area);
+    Invalidate(layer->GetArea());
   }
 }
 
 void LayerManager::MoveRelative(unsigned int id, Vector2D<int> pos_diff) {
+  MutexGuard lock{mutex_};
   auto layer = FindLayer(id);
   if(layer != nullptr) {    
     auto old_pos = layer->GetPosition();
@@ -99,46 +148,292 @@ void LayerManager::MoveRelative(unsigned int id, Vector2D<int> pos_diff) {
   }
 }
 
+// 即座に合成して画面に転送する。通常は Invalidate を使う
 void LayerManager::Draw(const Rectangle<int>& area) const {
-  for(auto layer : layer_stack_) {
-    layer->DrawTo(back_buffer_, area);    
+  MutexGuard lock{mutex_};
+  const auto screen_area = Rectangle<int>{{0, 0}, ScreenSize()} & area;
+  if(IsEmpty(screen_area)) {
+    return;
   }
 
-  screen_->Copy(area.pos, back_buffer_, area);
+  draw_rects_.clear();
+  draw_rects_.push_back(screen_area);
+  ComposeRects(draw_rects_);
 }
 
 void LayerManager::Draw(unsigned int id) const {
   Draw(id, {{0, 0}, {-1, -1}});
 }
 
+// レイヤ内の座標で指定した範囲を描画する。area の大きさが負ならレイヤ全体を描画する
 void LayerManager::Draw(unsigned int id, Rectangle<int> area) const {
-  bool draw = false;
-  Rectangle<int> window_area;
-  for(auto layer : layer_stack_) {
-    if(layer->ID() == id) {
-      window_area.size = layer->GetWindow()->Size();
-      window_area.pos = layer->GetPosition();
-      
-      if(area.size.x >= 0 || area.size.y >= 0) {
-        area.pos = area.pos + window_area.pos;
-        window_area = window_area & area;
+  MutexGuard lock{mutex_};
+  Draw(LayerAreaOnScreen(id, area));
+}
+
+void LayerManager::Invalidate(const Rectangle<int>& area) {
+  MutexGuard lock{mutex_};
+  const auto screen_area = Rectangle<int>{{0, 0}, ScreenSize()} & area;
+  if(IsEmpty(screen_area)) {
+    return;
+  }
+
+  damage_.Add(screen_area);
+  if(!compose_scheduled_ && timer_manager) {
+    compose_scheduled_ = true;
+    timer_manager->AddTimer(
+      Timer{timer_manager->CurrentTick() + kComposeTimerPeriod, kComposeTimerValue});
+  }
+}
+
+void LayerManager::Invalidate(unsigned int id) {
+  Invalidate(id, {{0, 0}, {-1, -1}});
+}
+
+void LayerManager::Invalidate(unsigned int id, Rectangle<int> area) {
+  MutexGuard lock{mutex_};
+  Invalidate(LayerAreaOnScreen(id, area));
+}
+
+void LayerManager::Compose() {
+  MutexGuard lock{mutex_};
+  compose_scheduled_ = false;
+
+  if(damage_.Empty()) {
+    return;
+  }
+
+  // damage_ の矩形は互いに重ならないので、各ピクセルは1フレームに1回だけ合成・転送される
+  const auto start = ReadTSC();
+  ComposeRects(damage_.Rects());
+  damage_.Clear();
+
+  const auto elapsed = ReadTSC() - start;
+  compose_frames_++;
+  compose_tsc_ += elapsed;
+  max_compose_tsc_ = std::max(max_compose_tsc_, elapsed);
+}
+
+Error LayerManager::CopyBackBuffer(FrameBuffer& dst, const Rectangle<int>& area) const {
+  MutexGuard lock{mutex_};
+  FrameBufferConfig config{};
+  config.frame_buffer = nullptr;
+  config.horizontal_resolution = area.size.x;
+  config.vertical_resolution = area.size.y;
+  config.pixel_format = back_buffer_.Config().pixel_format;
+  if(auto err = dst.Initialize(config)) {
+    return err;
+  }
+  return dst.Copy({0, 0}, back_buffer_, area);
+}
+
+void LayerManager::ComposeRects(const std::vector<Rectangle<int>>& rects) const {
+  for(const auto& rect : rects) {
+    ComposeArea(rect);
+  }
+  // すべて合成し終えてから画面へ転送する
+  for(const auto& rect : rects) {
+    screen_->Copy(rect.pos, back_buffer_, rect);
+    DrawCursor(rect);
+  }
+}
+
+void LayerManager::SetCursor(const std::shared_ptr<Window>& window, Vector2D<int> pos) {
+  MutexGuard lock{mutex_};
+  cursor_window_ = window;
+  cursor_pos_ = pos;
+  DrawCursor({pos, window->Size()});
+}
+
+void LayerManager::MoveCursor(Vector2D<int> pos) {
+  MutexGuard lock{mutex_};
+  if(!cursor_window_) {
+    cursor_pos_ = pos;
+    return;
+  }
+
+  const Rectangle<int> old_area{cursor_pos_, cursor_window_->Size()};
+  cursor_pos_ = pos;
+  screen_->Copy(old_area.pos, back_buffer_, old_area);
+  DrawCursor({pos, cursor_window_->Size()});
+}
+
+// 画面に転送したばかりの area にカーソルが重なっていれば描き直す
+void LayerManager::DrawCursor(const Rectangle<int>& area) const {
+  if(!cursor_window_) {
+    return;
+  }
+
+  const auto cursor_area = Rectangle<int>{cursor_pos_, cursor_window_->Size()} & area;
+  if(!IsEmpty(cursor_area)) {
+    cursor_window_->DrawTo(*screen_, cursor_pos_, cursor_area);
+  }
+}
+
+// 画面内に収まる area を back_buffer_ に合成する
+void LayerManager::ComposeArea(const Rectangle<int>& area) const {
+  damaged_pixels_ += area.size.x * area.size.y;
+
+  CollectLayers(area);
+  if(!occlusion_culling_) {
+    for(auto layer : candidates_) {
+      const auto draw_area = layer->GetArea() & area;
+      if(!IsEmpty(draw_area)) {
+        layer->DrawTo(back_buffer_, draw_area);
+        composed_pixels_ += draw_area.size.x * draw_area.size.y;
       }
-      
-      draw = true;
+    }
+    return;
+  }
+
+  // 上のレイヤから順に、まだ覆われていない部分のうちそのレイヤが描く部分を求める。
+  // 不透明なレイヤの下は見えないので、以降のレイヤの対象から除く
+  visible_.Clear();
+  visible_.Add(area);
+  fragments_.resize(candidates_.size());
+  for(int i = candidates_.size() - 1; i >= 0; i--) {
+    auto& fragments = fragments_[i];
+    fragments.clear();
+    if(visible_.Empty()) {
+      continue;
     }
 
-    if(draw) {
-      layer->DrawTo(back_buffer_, window_area);
+    const auto layer_area = candidates_[i]->GetArea();
+    for(const auto& v : visible_.Rects()) {
+      const auto fragment = v & layer_area;
+      if(!IsEmpty(fragment)) {
+        fragments.push_back(fragment);
+      }
+    }
+
+    if(!fragments.empty()) {
+      if(const auto opaque_area = candidates_[i]->OpaqueArea(); !IsEmpty(opaque_area)) {
+        visible_.Subtract(opaque_area);
+      }
+    }
+  }
+
+  // 透過色やアルファを持つレイヤがあるので、描画そのものは下のレイヤから行う
+  for(int i = 0; i < candidates_.size(); i++) {
+    for(const auto& fragment : fragments_[i]) {
+      candidates_[i]->DrawTo(back_buffer_, fragment);
+      composed_pixels_ += fragment.size.x * fragment.size.y;
+    }
+  }
+}
+
+// レイヤ内の座標で指定した範囲を画面座標に直す。表示されていないレイヤなら空の矩形を返す
+Rectangle<int> LayerManager::LayerAreaOnScreen(unsigned int id, Rectangle<int> area) const {
+  auto it = layer_by_id_.find(id);
+  if(it == layer_by_id_.end() || heights_.count(it->second) == 0) {
+    return {{0, 0}, {0, 0}};
+  }
+
+  auto window_area = it->second->GetArea();
+  if(area.size.x >= 0 || area.size.y >= 0) {
+    area.pos = area.pos + window_area.pos;
+    window_area = window_area & area;
+  }
+  return window_area;
+}
+
+// area に重なるタイルの範囲を、タイル単位の矩形で返す
+Rectangle<int> LayerManager::TileRange(const Rectangle<int>& area) const {
+  const auto screen_area = Rectangle<int>{{0, 0}, ScreenSize()} & area;
+  if(IsEmpty(screen_area)) {
+    return {{0, 0}, {0, 0}};
+  }
+
+  const auto end = screen_area.pos + screen_area.size;
+  const Vector2D<int> tile_pos{screen_area.pos.x / kTileSize, screen_area.pos.y / kTileSize};
+  const Vector2D<int> tile_end{(end.x + kTileSize - 1) / kTileSize, (end.y + kTileSize - 1) / kTileSize};
+  return {tile_pos, tile_end - tile_pos};
+}
+
+void LayerManager::IndexLayer(Layer* layer) {
+  const auto area = layer->GetArea();
+  const auto range = TileRange(area);
+  for(int ty = range.pos.y; ty < range.pos.y + range.size.y; ty++) {
+    for(int tx = range.pos.x; tx < range.pos.x + range.size.x; tx++) {
+      tiles_[ty * grid_size_.x + tx].push_back(layer);
+    }
+  }
+  indexed_area_[layer] = area;
+}
+
+void LayerManager::UnindexLayer(Layer* layer) {
+  auto it = indexed_area_.find(layer);
+  if(it == indexed_area_.end()) {
+    return;
+  }
+
+  const auto range = TileRange(it->second);
+  for(int ty = range.pos.y; ty < range.pos.y + range.size.y; ty++) {
+    for(int tx = range.pos.x; tx < range.pos.x + range.size.x; tx++) {
+      auto& tile = tiles_[ty * grid_size_.x + tx];
+      tile.erase(std::remove(tile.begin(), tile.end(), layer), tile.end());
+    }
+  }
+  indexed_area_.erase(it);
+}
+
+void LayerManager::UpdateHeights() {
+  heights_.clear();
+  for(int i = 0; i < layer_stack_.size(); i++) {
+    heights_[layer_stack_[i]] = i;
+  }
+}
+
+void LayerManager::CollectLayers(const Rectangle<int>& area) const {
+  candidates_.clear();
+  const auto range = TileRange(area);
+  // 画面の大半にかかるなら、タイルから集めるより全レイヤを見るほうが速い
+  if(range.size.x * range.size.y * 2 > grid_size_.x * grid_size_.y) {
+    for(auto layer : layer_stack_) {
+      if(!IsEmpty(layer->GetArea() & area)) {
+        candidates_.push_back(layer);
+      }
+    }
+    return;
+  }
+
+  for(int ty = range.pos.y; ty < range.pos.y + range.size.y; ty++) {
+    for(int tx = range.pos.x; tx < range.pos.x + range.size.x; tx++) {
+      for(auto layer : tiles_[ty * grid_size_.x + tx]) {
+        if(!IsEmpty(layer->GetArea() & area)) {
+          candidates_.push_back(layer);
+        }
+      }
     }
   }
-  screen_->Copy(window_area.pos, back_buffer_, window_area);
+
+  const auto by_height = [this](const Layer* lhs, const Layer* rhs) {
+    return heights_.at(lhs) < heights_.at(rhs);
+  };
+  std::sort(candidates_.begin(), candidates_.end(), by_height);
+  candidates_.erase(std::unique(candidates_.begin(), candidates_.end()), candidates_.end());
 }
 
 void LayerManager::Hide(unsigned int id) {
+  MutexGuard lock{mutex_};
   auto layer = FindLayer(id);
   auto pos = std::find(layer_stack_.begin(), layer_stack_.end(), layer);
   if(pos != layer_stack_.end()) {
     layer_stack_.erase(pos);
+    UnindexLayer(layer);
+    UpdateHeights();
+  }
+}
+
+void LayerManager::RemoveLayer(unsigned int id) {
+  MutexGuard lock{mutex_};
+  Hide(id);
+  layer_by_id_.erase(id);
+
+  auto it = std::find_if(layers_.begin(), layers_.end(),
+                         [id](const std::unique_ptr<Layer>& layer) { return layer->ID() == id; });
+  if(it != layers_.end()) {
+    layers_.erase(it);
   }
 }
 
@@ -149,6 +444,7 @@ const Layer& LayerManager::GetLayer(unsigned int id) {
 }
 
 void LayerManager::UpDown(unsigned int id, int new_height) {
+  MutexGuard lock{mutex_};
   if(new_height < 0) {
     Hide(id);
     return;
@@ -159,11 +455,17 @@ void LayerManager::UpDown(unsigned int id, int new_height) {
   }
 
   auto layer = FindLayer(id);
+  if(layer == nullptr) {
+    return;
+  }
+
   auto old_pos = std::find(layer_stack_.begin(), layer_stack_.end(), layer);
   auto new_pos = layer_stack_.begin() + new_height;
 
   if(old_pos == layer_stack_.end()) {
     layer_stack_.insert(new_pos, layer);
+    IndexLayer(layer);
+    UpdateHeights();
     return;
   }
 
@@ -173,55 +475,60 @@ void LayerManager::UpDown(unsigned int id, int new_height) {
 
   layer_stack_.erase(old_pos);
   layer_stack_.insert(new_pos, layer);
+  UpdateHeights();
 }
 
 Layer* LayerManager::FindLayerByPosition(Vector2D<int> pos, unsigned int exclude_id) const {
-  auto pred = [pos, exclude_id](Layer* layer) {
-    if(layer->ID() == exclude_id) {
-      return false;
-    }
-    const auto& win = layer->GetWindow();
-    if(!win) {
-      return false;
-    }
-
-    const auto win_pos = layer->GetPosition();
-    const auto win_end_pos = win_pos + win->Size();
+  MutexGuard lock{mutex_};
+  const auto range = TileRange({pos, {1, 1}});
+  if(IsEmpty(range)) {
+    return nullptr;
+  }
 
-    return win_pos.x <= pos.x && pos.x < win_end_pos.x && win_pos.y <= pos.y && pos.y <= win_end_pos.y;
-  };
+  Layer* found = nullptr;
+  int found_height = -1;
+  for(auto layer : tiles_[range.pos.y * grid_size_.x + range.pos.x]) {
+    if(layer->ID() == exclude_id || !layer->GetWindow()) {
+      continue;
+    }
 
-  auto it = std::find_if(layer_stack_.rbegin(), layer_stack_.rend(), pred);
-  if(it == layer_stack_.rend()) {
-    return nullptr;
+    const auto area = layer->GetArea();
+    const auto end = area.pos + area.size;
+    if(area.pos.x <= pos.x && pos.x < end.x && area.pos.y <= pos.y && pos.y < end.y) {
+      if(const int height = heights_.at(layer); height > found_height) {
+        found = layer;
+        found_height = height;
+      }
+    }
   }
 
-  return *it;
+  return found;
 }
 
 int LayerManager::GetHeight(unsigned int id) {
-  for(int i = 0; i < layer_stack_.size(); i++) {
-    if(layer_stack_[i]->ID() == id) {
-      return i;
-    }
+  MutexGuard lock{mutex_};
+  auto layer = FindLayer(id);
+  auto it = heights_.find(layer);
+  if(it == heights_.end()) {
+    return -1;
   }
 
-  return -1;
+  return it->second;
 }
 
 void InitializeLayer() {
   const auto screen_size = ScreenSize();
 
-  auto shadow_format = screen_config.pixel_format;
-  auto bgwindow = std::make_shared<Window>(screen_size.x, screen_size.y, shadow_format);
-  auto bgwriter = bgwindow->Writer();
+  auto shadow_format = window_pixel_format;
+  // デスクトップは数個の矩形だけなので、画素を持たずに合成時に塗る
+  auto desktop = std::make_shared<RectListContent>(screen_size, kDesktopBGColor);
 
   auto console_window = std::make_shared<Window>(
     Console::kColumns * 8, Console::kRows * 16, shadow_format
   );    
   console->SetWindow(console_window);
 
-  DrawDesktop(*bgwriter);  
+  DrawDesktop(*desktop->Writer());  
 
   screen = new FrameBuffer;
   if (auto err = screen->Initialize(screen_config)) {
@@ -234,7 +541,7 @@ void InitializeLayer() {
   layer_manager->SetWriter(screen);
 
   auto bglayer_id = layer_manager->NewLayer()
-    .SetWindow(bgwindow)
+    .SetContent(desktop)
     .Move({0, 0})
     .ID();
   console->SetLayerID(layer_manager->NewLayer()
@@ -251,27 +558,28 @@ void InitializeLayer() {
 ActiveLayer::ActiveLayer(LayerManager& manager): manager_{manager} {
 }
 
-void ActiveLayer::SetMouseLayer(unsigned int mouse_layer) {
-  mouse_layer_ = mouse_layer;
-}
-
 void ActiveLayer::Activate(unsigned int layer_id) {
+  MutexGuard lock{mutex_};
   if(active_layer_ == layer_id) {
     return;
   }
 
   if(active_layer_ > 0) {
     Layer* layer = manager_.FindLayer(active_layer_);
-    layer->GetWindow()->Deactivate();
-    manager_.Draw(active_layer_);
+    if(layer && layer->GetWindow()) {
+      layer->GetWindow()->Deactivate();
+    }
+    manager_.Invalidate(active_layer_);
   }
 
   active_layer_ = layer_id; 
   if(active_layer_ > 0) {
     Layer* layer = manager_.FindLayer(active_layer_);
-    layer->GetWindow()->Activate();
-    manager_.UpDown(active_layer_, manager_.GetHeight(mouse_layer_) - 1);
-    manager_.Draw(active_layer_);
+    if(layer && layer->GetWindow()) {
+      layer->GetWindow()->Activate();
+    }
+    manager_.UpDown(active_layer_, std::numeric_limits<int>::max());
+    manager_.Invalidate(active_layer_);
   }
 }
 
@@ -285,10 +593,10 @@ void ProcessLayerMessage(const Message& msg) {
       layer_manager->MoveRelative(arg.layer_id, {arg.x, arg.y});
       break;
     case LayerOperation::Draw:
-      layer_manager->Draw(arg.layer_id);
+      layer_manager->Invalidate(arg.layer_id);
       break; 
     case LayerOperation::DrawArea:
-      layer_manager->Draw(arg.layer_id, {{arg.x, arg.y}, {arg.w, arg.h}});
+      layer_manager->Invalidate(arg.layer_id, {{arg.x, arg.y}, {arg.w, arg.h}});
       break;
   }
 }
\ No newline at end of file
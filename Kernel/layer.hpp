@@ -2,11 +2,21 @@
 
 #include <memory>
 #include <map>
+#include <unordered_map>
 #include <vector> 
 
 #include "graphics.hpp"
 #include "window.hpp"
+#include "layer_content.hpp"
 #include "message.hpp"
+#include "sync.hpp"
+#include "region.hpp"
+#include "timer.hpp"
+
+// 画面の更新は溜めておき、kComposeFreq Hz を上限にまとめて合成する
+const int kComposeFreq = 50;
+const int kComposeTimerPeriod = kTimerFreq / kComposeFreq;
+const int kComposeTimerValue = kTaskTimerValue + 1;
 
 class Layer {
   public:
@@ -15,6 +25,8 @@ class Layer {
 
     Layer& SetWindow(const std::shared_ptr<Window>& window);
     std::shared_ptr<Window> GetWindow() const;
+    // 画素を持たない内容を設定する。ウィンドウとはどちらか一方だけを持つ
+    Layer& SetContent(const std::shared_ptr<LayerContent>& content);
 
     Layer& Move(Vector2D<int> pos);
     Layer& MoveRelative(Vector2D<int> pos_diff);    
@@ -22,6 +34,10 @@ class Layer {
 
     void DrawTo(FrameBuffer& screen, const Rectangle<int>& area);    
     Vector2D<int> GetPosition() const;
+    Rectangle<int> GetArea() const;
+    bool IsOpaque() const;
+    // 下のレイヤを完全に覆う範囲（画面座標）
+    Rectangle<int> OpaqueArea() const;
     
     bool IsDraggable() const;
 
@@ -29,6 +45,7 @@ class Layer {
     unsigned int id_;
     Vector2D<int> pos_;
     std::shared_ptr<Window> window_;
+    std::shared_ptr<LayerContent> content_;
     bool draggable_{false};
 };
 
@@ -43,35 +60,104 @@ class LayerManager {
     void MoveRelative(unsigned int id, Vector2D<int> pos_diff);
     void UpDown(unsigned int id, int new_height);
     void Hide(unsigned int id);
+    void RemoveLayer(unsigned int id);
     const Layer& GetLayer(unsigned int id);
     Layer* FindLayerByPosition(Vector2D<int> pos, unsigned int exclude_id) const;    
     Layer* FindLayer(unsigned int id);    
     int GetHeight(unsigned int id);
+
+    // 指定範囲を更新が必要な領域に加える。実際の描画は次の Compose でまとめて行う
+    void Invalidate(const Rectangle<int>& area);
+    void Invalidate(unsigned int id);
+    void Invalidate(unsigned int id, Rectangle<int> area);
+    // 溜まった更新領域を合成して画面に転送する。メインタスクが合成用タイマで呼ぶ
+    void Compose();
+
+    // マウスカーソルはレイヤとして合成せず、画面への転送のあとに最前面へ重ねる
+    void SetCursor(const std::shared_ptr<Window>& window, Vector2D<int> pos);
+    // カーソルの下は合成済みの back_buffer_ から戻すので、ウィンドウの数によらず小さな転送2回で済む
+    void MoveCursor(Vector2D<int> pos);
+
+    // 上のレイヤに完全に覆われた部分の描画を省く。比較計測用に無効化できる
+    void SetOcclusionCulling(bool enable) { occlusion_culling_ = enable; }
+    // Draw が合成したピクセル数と、要求された領域のピクセル数の累計
+    uint64_t ComposedPixels() const { return composed_pixels_; }
+    uint64_t DamagedPixels() const { return damaged_pixels_; }
+    // Compose が合成した回数と、それにかかった時間 (TSC) の合計・最大
+    uint64_t ComposeFrames() const { return compose_frames_; }
+    uint64_t ComposeTSC() const { return compose_tsc_; }
+    uint64_t MaxComposeTSC() const { return max_compose_tsc_; }
+    void ResetDrawStatistics() {
+      composed_pixels_ = damaged_pixels_ = 0;
+      compose_frames_ = compose_tsc_ = max_compose_tsc_ = 0;
+    }
+    // 合成済みの画面（カーソルを除く）の area を、大きさ area.size の dst にコピーする
+    Error CopyBackBuffer(FrameBuffer& dst, const Rectangle<int>& area) const;
     
   private:
+    // rects を合成して画面に転送する。rects は互いに重ならないこと
+    void ComposeRects(const std::vector<Rectangle<int>>& rects) const;
+    void ComposeArea(const Rectangle<int>& area) const;
+    // 表示中のレイヤを、重なるタイルに登録する・外す
+    void IndexLayer(Layer* layer);
+    void UnindexLayer(Layer* layer);
+    void UpdateHeights();
+    // area に重なる表示中のレイヤを、下から順に candidates_ に集める
+    void CollectLayers(const Rectangle<int>& area) const;
+    Rectangle<int> TileRange(const Rectangle<int>& area) const;
+    Rectangle<int> LayerAreaOnScreen(unsigned int id, Rectangle<int> area) const;
+    void DrawCursor(const Rectangle<int>& area) const;
+
     FrameBuffer* screen_{nullptr};    
     mutable FrameBuffer back_buffer_{};
+    mutable Mutex mutex_{};
     std::vector<std::unique_ptr<Layer>> layers_{};
     std::vector<Layer*> layer_stack_{};
     unsigned int latest_id_{0};    
+
+    // ID からレイヤを引く表と、表示中のレイヤの高さ
+    std::unordered_map<unsigned int, Layer*> layer_by_id_{};
+    std::unordered_map<const Layer*, int> heights_{};
+    // 画面を kTileSize 四方のタイルに分け、タイルごとに重なる表示中のレイヤを持つ。
+    // 登録したときの範囲を覚えておき、外すときはそれを使う
+    static const int kTileSize = 64;
+    Vector2D<int> grid_size_{0, 0};
+    std::vector<std::vector<Layer*>> tiles_{};
+    std::unordered_map<const Layer*, Rectangle<int>> indexed_area_{};
+    mutable std::vector<Layer*> candidates_{};
+
+    bool occlusion_culling_{true};
+    mutable uint64_t composed_pixels_{0};
+    mutable uint64_t damaged_pixels_{0};
+    uint64_t compose_frames_{0};
+    uint64_t compose_tsc_{0};
+    uint64_t max_compose_tsc_{0};
+    Region damage_{};
+    std::shared_ptr<Window> cursor_window_{};
+    Vector2D<int> cursor_pos_{0, 0};
+    bool compose_scheduled_{false};
+    // 合成のたびに確保し直さないよう使い回す作業領域
+    mutable Region visible_{};
+    mutable std::vector<std::vector<Rectangle<int>>> fragments_{};
+    mutable std::vector<Rectangle<int>> draw_rects_{};
 };
 
 class ActiveLayer {
   public:
     ActiveLayer(LayerManager& manager);
-    void SetMouseLayer(unsigned int mouse_layer);
     void Activate(unsigned int layer_id);
     unsigned int GetActive() const { return active_layer_; }
 
   private:
     LayerManager& manager_;
     unsigned int active_layer_{0};
-    unsigned int mouse_layer_{0};
+    Mutex mutex_{};
 };
 
 inline LayerManager* layer_manager;
 inline ActiveLayer* active_layer;
 inline std::map<unsigned int, uint64_t>* layer_task_map;
+inline Mutex* layer_task_map_mutex;
 
 void InitializeLayer();
 void ProcessLayerMessage(const Message& message);
\ No newline at end of file
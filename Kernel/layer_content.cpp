@@ -0,0 +1,82 @@
+#include "layer_content.hpp"
+
+#include <algorithm>
+
+void SolidContent::DrawTo(FrameBuffer& dst, Vector2D<int> pos, const Rectangle<int>& area) const {
+  dst.Writer().FillRect(area & Rectangle<int>{pos, size_}, color_);
+}
+
+void RectListContent::AddRect(const Rectangle<int>& rect, const PixelColor& c) {
+  const auto clipped = rect & Rectangle<int>{{0, 0}, size_};
+  if(IsEmpty(clipped)) {
+    return;
+  }
+
+  // 背景色と同じ色で全体を塗るものは記録しなくてよい
+  if(items_.empty() && c == background_ &&
+     clipped.pos.x == 0 && clipped.pos.y == 0 && clipped.size.x == size_.x && clipped.size.y == size_.y) {
+    return;
+  }
+
+  // 新しい矩形に覆われて見えなくなるものは捨てる
+  items_.erase(std::remove_if(items_.begin(), items_.end(), [&](const Item& item) {
+    return Contains(clipped, item.rect);
+  }), items_.end());
+  items_.push_back({clipped, c});
+}
+
+void RectListContent::DrawTo(FrameBuffer& dst, Vector2D<int> pos, const Rectangle<int>& area) const {
+  auto& writer = dst.Writer();
+  const auto draw_area = area & Rectangle<int>{pos, size_};
+  if(IsEmpty(draw_area)) {
+    return;
+  }
+
+  // 描画範囲を覆う最後の矩形より前のもの（と背景）は塗らなくてよい
+  size_t first = 0;
+  auto background = background_;
+  for(size_t i = items_.size(); i > 0; --i) {
+    const auto& item = items_[i - 1];
+    const Rectangle<int> rect{pos + item.rect.pos, item.rect.size};
+    if(Contains(rect, draw_area)) {
+      first = i;
+      background = item.color;
+      break;
+    }
+  }
+
+  writer.FillRect(draw_area, background);
+  for(size_t i = first; i < items_.size(); ++i) {
+    const auto& item = items_[i];
+    const auto rect = draw_area & Rectangle<int>{pos + item.rect.pos, item.rect.size};
+    if(!IsEmpty(rect)) {
+      writer.FillRect(rect, item.color);
+    }
+  }
+}
+
+void TiledContent::DrawTo(FrameBuffer& dst, Vector2D<int> pos, const Rectangle<int>& area) const {
+  const auto draw_area = area & Rectangle<int>{pos, size_};
+  if(IsEmpty(draw_area)) {
+    return;
+  }
+
+  const auto tile_size = tile_->Size();
+  const auto start = draw_area.pos - pos;
+  const auto end = start + draw_area.size;
+  const int tx_begin = start.x / tile_size.x * tile_size.x;
+  const int ty_begin = start.y / tile_size.y * tile_size.y;
+  for(int ty = ty_begin; ty < end.y; ty += tile_size.y) {
+    for(int tx = tx_begin; tx < end.x; tx += tile_size.x) {
+      const auto tile_area = draw_area & Rectangle<int>{pos + Vector2D<int>{tx, ty}, tile_size};
+      tile_->DrawTo(dst, pos + Vector2D<int>{tx, ty}, tile_area);
+    }
+  }
+}
+
+Rectangle<int> TiledContent::OpaqueArea() const {
+  if(!tile_->IsOpaque()) {
+    return {{0, 0}, {0, 0}};
+  }
+  return {{0, 0}, size_};
+}
\ No newline at end of file
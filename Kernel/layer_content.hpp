@@ -0,0 +1,87 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "graphics.hpp"
+#include "frame_buffer.hpp"
+#include "window.hpp"
+
+// 画素を持たず、合成のたびに描画先へ直接描くレイヤの内容
+class LayerContent {
+  public:
+    virtual ~LayerContent() = default;
+    virtual Vector2D<int> Size() const = 0;
+    // pos に置いた内容のうち、画面座標の area に入る部分を dst に描く
+    virtual void DrawTo(FrameBuffer& dst, Vector2D<int> pos, const Rectangle<int>& area) const = 0;
+    // 下のレイヤを完全に覆う範囲（内容の座標）
+    virtual Rectangle<int> OpaqueArea() const { return {{0, 0}, Size()}; }
+};
+
+// 単色で塗りつぶす
+class SolidContent : public LayerContent {
+  public:
+    SolidContent(Vector2D<int> size, const PixelColor& color) : size_{size}, color_{color} {}
+    virtual Vector2D<int> Size() const override { return size_; }
+    virtual void DrawTo(FrameBuffer& dst, Vector2D<int> pos, const Rectangle<int>& area) const override;
+
+  private:
+    Vector2D<int> size_;
+    PixelColor color_;
+};
+
+// 背景色で塗ったうえに、記録した矩形を順に塗る
+class RectListContent : public LayerContent {
+  public:
+    // 矩形を記録する PixelWriter。DrawDesktop などの既存の描画関数をそのまま使える
+    class Recorder : public PixelWriter {
+      public:
+        Recorder(RectListContent& content) : content_{content} {}
+        virtual void Write(Vector2D<int> pos, const PixelColor& c) override {
+          content_.AddRect({pos, {1, 1}}, c);
+        }
+        virtual int Width() const override { return content_.size_.x; }
+        virtual int Height() const override { return content_.size_.y; }
+        virtual void FillRect(const Rectangle<int>& rect, const PixelColor& c) override {
+          content_.AddRect(rect, c);
+        }
+        virtual void FillSpan(Vector2D<int> pos, int length, const PixelColor& c) override {
+          content_.AddRect({pos, {length, 1}}, c);
+        }
+
+      private:
+        RectListContent& content_;
+    };
+
+    RectListContent(Vector2D<int> size, const PixelColor& background)
+      : size_{size}, background_{background} {}
+    void AddRect(const Rectangle<int>& rect, const PixelColor& c);
+    Recorder* Writer() { return &recorder_; }
+
+    virtual Vector2D<int> Size() const override { return size_; }
+    virtual void DrawTo(FrameBuffer& dst, Vector2D<int> pos, const Rectangle<int>& area) const override;
+
+  private:
+    struct Item {
+      Rectangle<int> rect;
+      PixelColor color;
+    };
+
+    Vector2D<int> size_;
+    PixelColor background_;
+    std::vector<Item> items_{};
+    Recorder recorder_{*this};
+};
+
+// 小さなウィンドウを敷き詰める
+class TiledContent : public LayerContent {
+  public:
+    TiledContent(Vector2D<int> size, const std::shared_ptr<Window>& tile) : size_{size}, tile_{tile} {}
+    virtual Vector2D<int> Size() const override { return size_; }
+    virtual void DrawTo(FrameBuffer& dst, Vector2D<int> pos, const Rectangle<int>& area) const override;
+    virtual Rectangle<int> OpaqueArea() const override;
+
+  private:
+    Vector2D<int> size_;
+    std::shared_ptr<Window> tile_;
+};
\ No newline at end of file
@@ -28,7 +28,11 @@
 #include "task.hpp"
 #include "terminal.hpp"
 #include "fat.hpp"
+#include "input_record.hpp"
 #include "syscall.hpp"
+#include "sync.hpp"
+#include "buffer_pool.hpp"
+#include "serial.hpp"
 #include "usb/memory.hpp"
 #include "usb/device.hpp"
 #include "usb/classdriver/mouse.hpp"
@@ -99,7 +103,7 @@ void show_memory_map(const MemoryMap& memmap) {
 }
 
 unsigned int InitializeMainWindow() {
-  auto main_window = std::make_shared<ToplevelWindow>(160, 52, screen_config.pixel_format, "Main Window");
+  auto main_window = std::make_shared<ToplevelWindow>(160, 52, window_pixel_format, "Main Window");
 
   auto main_window_layer_id = layer_manager->NewLayer()
     .SetWindow(main_window)
@@ -119,7 +123,7 @@ unsigned InitializeTextWindow() {
   const int win_w = 160;
   const int win_h = 52;
 
-  text_window = std::make_shared<ToplevelWindow>(win_w, win_h, screen_config.pixel_format, "Text Window");
+  text_window = std::make_shared<ToplevelWindow>(win_w, win_h, window_pixel_format, "Text Window");
   DrawTextBox(*text_window->InnerWriter(), {0, 0}, text_window->InnerSize());
 
   auto text_window_layer_id = layer_manager->NewLayer()
@@ -158,7 +162,7 @@ void InputTextWindow(ToplevelWindow& window, const unsigned int id, char c) {
     text_window_index++;
   } 
 
-  layer_manager->Draw(id);
+  layer_manager->Invalidate(id);
 }
 
 void IdleTask(uint64_t task_id, int64_t data) {
@@ -201,9 +205,11 @@ extern "C" void kernel_main_new_stack(
 
   InitializeGraphics(frame_buffer_config_ref);
   InitializeConsole();  
+  InitializeSerial();
   InitializeSegment();
   InitializePagetable();
   InitializeMemoryManager(memmap);    
+  InitializeBufferPool();
   InitializeTSS();
     
   InitializeInterrupt();
@@ -217,6 +223,10 @@ extern "C" void kernel_main_new_stack(
   const int kTimer05Sec = static_cast<int>(kTimerFreq * 0.5);
   bool text_cursor_visible = false;  
   timer_manager->AddTimer(Timer{kTimer05Sec, kTextboxCursorTime});
+  // カウンタは専用のタイマで更新し、合成のためのタイマで起きたときに再び合成を予約しないようにする
+  const int kCounterTime = 2;
+  const int kCounterPeriod = static_cast<int>(kTimerFreq * 0.1);
+  timer_manager->AddTimer(Timer{kCounterPeriod, kCounterTime});
   
   InitializeLayer();
   auto main_window_layer_id = InitializeMainWindow();    
@@ -231,54 +241,46 @@ extern "C" void kernel_main_new_stack(
   
   InitializeTask();
   terminals = new std::map<uint64_t, Terminal*>;
+  terminals_mutex = new Mutex;
   Task& main_task = task_manager->CurrentTask();
   const uint64_t task_terminal_id = task_manager->NewTask().InitContext(TaskTerminal, 0).Wakeup().ID();
+  StartSerialTask();
 
   layer_task_map = new std::map<unsigned int, uint64_t>();
+  layer_task_map_mutex = new Mutex;
 
   usb::xhci::Initialize();    
   InitializeMouse();
   InitializeKeyboard();
+  InitializeInputRecorder();
 
   ShowVolumeImage(volume_image);
 
   __asm__("sti");  
 
   while(true) {
-    __asm__("cli");
-    const auto tick = timer_manager->CurrentTick();    
-    __asm__("sti");
-    
-    sprintf(counter_str, "0x%08X", tick);    
-    FillRectangle(*main_window_writer, {24, 28}, {8 * 10, 16}, ToColor(0xC6C6C6));
-    WriteString(*main_window_writer, {24, 28}, counter_str, ToColor(0x000000));
-    layer_manager->Draw(main_window_layer_id);
-    __asm__("cli");
-    auto msg_opt = main_task.ReceiveMessage();
-    if(!msg_opt.has_value()) {
-      main_task.Sleep();      
-      __asm__("sti");
-      continue;
-    }
-    
-    auto msg = msg_opt.value();    
-    __asm__("sti");
+    auto msg = main_task.WaitMessage();
     switch(msg.type) {
       case Message::kInterruptXHCI:
         usb::xhci::ProcessEvents();        
         break;     
       case Message::kTimerTimeout:                
         if(msg.arg.timer.value == kTextboxCursorTime) {          
-          __asm__("cli");          
           timer_manager->AddTimer(Timer{msg.arg.timer.timeout + kTimer05Sec, kTextboxCursorTime});
-          __asm__("sti");
           text_cursor_visible = !text_cursor_visible;
           DrawTextCursor(text_cursor_visible);
-          layer_manager->Draw(text_window_layer_id);
+          layer_manager->Invalidate(text_window_layer_id);
 
-          __asm__("cli");
           task_manager->SendMessage(task_terminal_id, msg);
-          __asm__("sti");
+        } else if(msg.arg.timer.value == kCounterTime) {
+          timer_manager->AddTimer(Timer{msg.arg.timer.timeout + kCounterPeriod, kCounterTime});
+          sprintf(counter_str, "0x%08lX", timer_manager->CurrentTick());
+          WriteString(*main_window_writer, {24, 28}, counter_str, ToColor(0x000000), ToColor(0xC6C6C6));
+          layer_manager->Invalidate(main_window_layer_id, {{24, 28}, {8 * 10, 16}});
+        } else if(msg.arg.timer.value == kComposeTimerValue) {
+          layer_manager->Compose();
+        } else if(msg.arg.timer.value == kInputReplayTimerValue) {
+          input_recorder->OnReplayTimer();
         }
         
         break;
@@ -286,14 +288,11 @@ extern "C" void kernel_main_new_stack(
         if(auto active = active_layer->GetActive(); active == text_window_layer_id) {
           InputTextWindow(*text_window, text_window_layer_id, msg.arg.keyboard.ascii);
         } else {
-          __asm__("cli");
+          MutexGuard lock{*layer_task_map_mutex};
           auto task_it = layer_task_map->find(active);
-          __asm__("sti");
 
           if(task_it != layer_task_map->end()) {
-            __asm__("cli");
             task_manager->SendMessage(task_it->second, msg);
-            __asm__("sti");
           } else {
             printk("key push not handled: keycode %02x, ascii %02x\n", msg.arg.keyboard.keycode, msg.arg.keyboard.ascii);
           }
@@ -301,9 +300,7 @@ extern "C" void kernel_main_new_stack(
         break;
       case Message::kLayer:
         ProcessLayerMessage(msg);
-        __asm__("cli");
-        task_manager->SendMessage(msg.src_task, Message{Message::kLayerFinish});
-        __asm__("sti");
+        task_manager->Reply(msg, Message{Message::kLayerFinish});
         break;
       default:
         Log(kError, "Unknown message type: %d\n", msg.type);
@@ -14,9 +14,12 @@ struct Message {
     kKeyPush,
     kLayer,
     kLayerFinish,
+    kBuffer,
   } type;
 
   uint64_t src_task;
+  // TaskManager::Call が要求ごとに振る番号。返信には要求の番号が入る。Call でなければ 0
+  uint64_t seq;
 
   union { 
     struct {
@@ -36,5 +39,11 @@ struct Message {
       int w;
       int h;
     } layer;
+    // BufferPool のバッファ。参照の所有権ごと受信側に渡る
+    struct {
+      uint32_t handle;
+      uint32_t size;
+      int value;
+    } buffer;
   } arg;
 };
\ No newline at end of file
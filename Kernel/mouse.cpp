@@ -49,12 +49,9 @@ void DrawMouseCursor(PixelWriter* pixel_writer, Vector2D<int> position) {
   }
 }
 
-Mouse::Mouse(unsigned int layer_id) : layer_id_{layer_id} {
-}
-
 void Mouse::SetPosition(Vector2D<int> position) {
   position_ = position;
-  layer_manager->Move(layer_id_, position_);
+  layer_manager->MoveCursor(position_);
 }
 
 void Mouse::OnInterrupt(uint8_t buttons, int8_t displacement_x, int8_t displacement_y) {
@@ -65,12 +62,12 @@ void Mouse::OnInterrupt(uint8_t buttons, int8_t displacement_x, int8_t displacem
 
   const auto posdiff = position_ - oldpos;
 
-  layer_manager->Move(layer_id_, position_);
+  layer_manager->MoveCursor(position_);
 
   const bool previous_left_pressed = (previous_buttons_ & 0x01);
   const bool left_pressed = (buttons & 0x01);
   if (!previous_left_pressed && left_pressed) {
-    auto layer = layer_manager->FindLayerByPosition(position_, layer_id_);
+    auto layer = layer_manager->FindLayerByPosition(position_, 0);
     if (layer && layer->IsDraggable()) {
       drag_layer_id_ = layer->ID();
       active_layer->Activate(layer->ID());
@@ -90,19 +87,13 @@ void Mouse::OnInterrupt(uint8_t buttons, int8_t displacement_x, int8_t displacem
 
 void InitializeMouse() {
   auto mouse_window = std::make_shared<Window>(
-      kMouseCursorWidth, kMouseCursorHeight, screen_config.pixel_format);
+      kMouseCursorWidth, kMouseCursorHeight, window_pixel_format);
   mouse_window->SetTransparentColor(kMouseTransparentColor);
   DrawMouseCursor(mouse_window->Writer(), {0, 0});
 
-  auto mouse_layer_id = layer_manager->NewLayer()
-    .SetWindow(mouse_window)
-    .ID();
-
-  auto mouse = std::make_shared<Mouse>(mouse_layer_id);
+  auto mouse = std::make_shared<Mouse>();
+  layer_manager->SetCursor(mouse_window, {200, 200});
   mouse->SetPosition({200, 200});
-  layer_manager->UpDown(mouse->LayerID(), std::numeric_limits<int>::max());
-
-  active_layer->SetMouseLayer(mouse_layer_id);
 
   usb::HIDMouseDriver::default_observer =
     [mouse](uint8_t buttons, int8_t displacement_x, int8_t displacement_y) {
@@ -100,6 +100,72 @@ Error SetupPageMaps(LinearAddress4Level addr, size_t num_4kpages) {
   return SetupPageMap(pml4_table, 4, addr, num_4kpages).error;
 }
 
+WithError<size_t> MapSharedPage(PageMapEntry* table, int page_map_level, LinearAddress4Level addr,
+                                uintptr_t& phys_addr, size_t num_4kpages) {
+  while(num_4kpages > 0) {
+    const auto entry_index = addr.Part(page_map_level);
+    if(page_map_level == 1) {
+      table[entry_index].data = 0;
+      table[entry_index].SetPointer(reinterpret_cast<PageMapEntry*>(phys_addr));
+      table[entry_index].bits.present = 1;
+      table[entry_index].bits.writable = 1;
+      table[entry_index].bits.user = 1;
+      table[entry_index].bits.shared = 1;
+      phys_addr += kPageSize4K;
+      num_4kpages--;
+    } else {
+      auto [ child_table, err ] = SetNewPageMapIfNotPresent(&table[entry_index]);
+      if(err) {
+        return { num_4kpages, err };
+      }
+      table[entry_index].bits.writable = 1;
+      table[entry_index].bits.user = 1;
+
+      auto [ num_remain_pages, err2 ] = MapSharedPage(child_table, page_map_level - 1, addr, phys_addr, num_4kpages);
+      if(err2) {
+        return { num_4kpages, err2 };
+      }
+      num_4kpages = num_remain_pages;
+    }
+
+    if(entry_index == 511) {
+      break;
+    }
+
+    addr.SetPart(page_map_level, entry_index + 1);
+    for(int level = page_map_level - 1; level >= 1; level--) {
+      addr.SetPart(level, 0);
+    }
+  }
+
+  return { num_4kpages, MAKE_ERROR(Error::kSuccess) };
+}
+
+Error MapSharedPages(LinearAddress4Level addr, uintptr_t phys_addr, size_t num_4kpages) {
+  auto pml4_table = reinterpret_cast<PageMapEntry*>(GetCR3());
+  const auto err = MapSharedPage(pml4_table, 4, addr, phys_addr, num_4kpages).error;
+  if(err) {
+    // 途中まで書いた末端のエントリを残すと、呼び出し側がバッファを解放した後もアプリから書けてしまう
+    UnmapSharedPages(addr, num_4kpages);
+  }
+  return err;
+}
+
+void UnmapSharedPages(LinearAddress4Level addr, size_t num_4kpages) {
+  auto pml4_table = reinterpret_cast<PageMapEntry*>(GetCR3());
+  for(size_t i = 0; i < num_4kpages; ++i) {
+    const LinearAddress4Level page{addr.value + i * kPageSize4K};
+    auto table = pml4_table;
+    for(int level = 4; level > 1 && table; --level) {
+      const auto entry = table[page.Part(level)];
+      table = entry.bits.present && !entry.bits.huge_page ? entry.Pointer() : nullptr;
+    }
+    if(table && table[page.Part(1)].bits.shared) {
+      table[page.Part(1)].data = 0;
+    }
+  }
+}
+
 Error CleanPageMap(PageMapEntry* table, int page_map_level) {
   for(int i = 0; i < 512; i++) {
     auto entry = table[i];
@@ -113,6 +179,11 @@ Error CleanPageMap(PageMapEntry* table, int page_map_level) {
       }
     }
 
+    if(entry.bits.shared) {
+      table[i].data = 0;
+      continue;
+    }
+
     const auto entry_addr = reinterpret_cast<uintptr_t>(entry.Pointer());
     const FrameID map_frame{entry_addr / kBytesPerFrame};
     if(auto err = memory_manager->Free(map_frame, 1)) {
@@ -136,4 +207,31 @@ Error CleanPageMaps(LinearAddress4Level addr) {
   const auto pdp_addr = reinterpret_cast<uintptr_t>(pdp_table);
   const FrameID pdp_frame{pdp_addr / kBytesPerFrame};
   return memory_manager->Free(pdp_frame, 1);
+}
+
+bool IsUserAccessible(uint64_t addr, size_t bytes, bool writable) {
+  if(bytes == 0) {
+    return true;
+  }
+  if(addr + bytes < addr) {
+    return false;
+  }
+
+  auto pml4_table = reinterpret_cast<PageMapEntry*>(GetCR3());
+  const uint64_t first_page = addr / kPageSize4K;
+  const uint64_t num_pages = (addr + bytes - 1) / kPageSize4K - first_page + 1;
+  for(uint64_t i = 0; i < num_pages; ++i) {
+    const LinearAddress4Level page{(first_page + i) * kPageSize4K};
+    auto table = pml4_table;
+    for(int level = 4; level >= 1; --level) {
+      const auto entry = table[page.Part(level)];
+      // アプリのページは 4KiB だけなので、大きなページはカーネルのものとして扱う
+      if(!entry.bits.present || !entry.bits.user || (writable && !entry.bits.writable) ||
+         (level > 1 && entry.bits.huge_page)) {
+        return false;
+      }
+      table = entry.Pointer();
+    }
+  }
+  return true;
 }
\ No newline at end of file
@@ -51,7 +51,9 @@ union PageMapEntry {
     uint64_t dirty : 1;
     uint64_t huge_page : 1;
     uint64_t global : 1;
-    uint64_t : 3;
+    // カーネルが持つメモリを割り当てたページ。ページマップを片付けるときに解放しない
+    uint64_t shared : 1;
+    uint64_t : 2;
 
     uint64_t addr : 40;
     uint64_t : 12;
@@ -68,4 +70,11 @@ union PageMapEntry {
 
 void InitializePagetable();
 Error SetupPageMaps(LinearAddress4Level addr, size_t num_4kpages);
-Error CleanPageMaps(LinearAddress4Level addr);
\ No newline at end of file
+// 新しいフレームを確保せず、物理アドレス phys_addr から続くページを addr にアプリから書けるように割り当てる
+// 失敗したときは、途中まで割り当てたページを UnmapSharedPages で外してから返す
+Error MapSharedPages(LinearAddress4Level addr, uintptr_t phys_addr, size_t num_4kpages);
+// MapSharedPages で割り当てたページを外す。途中のページテーブルはそのまま残す
+void UnmapSharedPages(LinearAddress4Level addr, size_t num_4kpages);
+Error CleanPageMaps(LinearAddress4Level addr);
+// addr から bytes バイトのページがすべて、今のページテーブルでアプリから読める（writable なら書ける）か
+bool IsUserAccessible(uint64_t addr, size_t bytes, bool writable);
\ No newline at end of file
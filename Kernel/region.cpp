@@ -0,0 +1,123 @@
+#include <iterator>
+
+#include "region.hpp"
+
+namespace {
+  uint64_t AreaOf(const Rectangle<int>& rect) {
+    return IsEmpty(rect) ? 0 : static_cast<uint64_t>(rect.size.x) * rect.size.y;
+  }
+
+  Rectangle<int> Union(const Rectangle<int>& lhs, const Rectangle<int>& rhs) {
+    const auto pos = ElementMin(lhs.pos, rhs.pos);
+    const auto end = ElementMax(lhs.pos + lhs.size, rhs.pos + rhs.size);
+    return {pos, end - pos};
+  }
+
+  bool Contains(const Rectangle<int>& outer, const Rectangle<int>& inner) {
+    const auto outer_end = outer.pos + outer.size;
+    const auto inner_end = inner.pos + inner.size;
+    return outer.pos.x <= inner.pos.x && outer.pos.y <= inner.pos.y &&
+           inner_end.x <= outer_end.x && inner_end.y <= outer_end.y;
+  }
+
+  // 外接矩形にまとめたときに増える面積が、この割合以下ならまとめる
+  const int kMergeWastePercent = 25;
+}
+
+void Region::Add(const Rectangle<int>& rect) {
+  if(IsEmpty(rect)) {
+    return;
+  }
+
+  auto new_rect = rect;
+  bool merged = true;
+  while(merged) {
+    merged = false;
+    for(auto it = rects_.begin(); it != rects_.end(); ++it) {
+      if(Contains(*it, new_rect)) {
+        return;
+      }
+
+      const auto bounds = Union(*it, new_rect);
+      const auto covered = AreaOf(*it) + AreaOf(new_rect) - AreaOf(*it & new_rect);
+      if(AreaOf(bounds) * 100 <= covered * (100 + kMergeWastePercent)) {
+        rects_.erase(it);
+        new_rect = bounds;
+        merged = true;
+        break;
+      }
+    }
+  }
+
+  // 既存の矩形と重ならない部分だけを追加する
+  std::vector<Rectangle<int>> pieces{new_rect};
+  std::vector<Rectangle<int>> next_pieces;
+  for(const auto& r : rects_) {
+    next_pieces.clear();
+    for(const auto& piece : pieces) {
+      SubtractRectangle(piece, r, std::back_inserter(next_pieces));
+    }
+    pieces.swap(next_pieces);
+  }
+  rects_.insert(rects_.end(), pieces.begin(), pieces.end());
+
+  if(rects_.size() > kMaxRects) {
+    const auto bounds = Bounds();
+    rects_.clear();
+    rects_.push_back(bounds);
+  }
+}
+
+void Region::Add(const Region& region) {
+  for(const auto& rect : region.rects_) {
+    Add(rect);
+  }
+}
+
+void Region::Subtract(const Rectangle<int>& rect) {
+  std::vector<Rectangle<int>> result;
+  for(const auto& r : rects_) {
+    SubtractRectangle(r, rect, std::back_inserter(result));
+  }
+  rects_.swap(result);
+}
+
+void Region::Intersect(const Rectangle<int>& rect) {
+  std::vector<Rectangle<int>> result;
+  for(const auto& r : rects_) {
+    const auto i = r & rect;
+    if(!IsEmpty(i)) {
+      result.push_back(i);
+    }
+  }
+  rects_.swap(result);
+}
+
+bool Region::Intersects(const Rectangle<int>& rect) const {
+  for(const auto& r : rects_) {
+    if(!IsEmpty(r & rect)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint64_t Region::Area() const {
+  uint64_t area = 0;
+  for(const auto& r : rects_) {
+    area += AreaOf(r);
+  }
+  return area;
+}
+
+Rectangle<int> Region::Bounds() const {
+  if(rects_.empty()) {
+    return {{0, 0}, {0, 0}};
+  }
+
+  auto bounds = rects_[0];
+  for(const auto& r : rects_) {
+    bounds = Union(bounds, r);
+  }
+  return bounds;
+}
\ No newline at end of file
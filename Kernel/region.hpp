@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "graphics.hpp"
+
+// 互いに重ならない矩形の集合で表した領域。
+// 各ピクセルはいずれか1つの矩形にしか含まれないので、領域を1回なめれば各ピクセルを1回だけ処理できる
+class Region {
+  public:
+    // 矩形数がこれを超えたら外接矩形1つにまとめる
+    static const int kMaxRects = 16;
+
+    Region() = default;
+    Region(const Rectangle<int>& rect) { Add(rect); }
+
+    // 和をとる。近くの矩形とまとめたほうが無駄が少なければ外接矩形にまとめる
+    void Add(const Rectangle<int>& rect);
+    void Add(const Region& region);
+    void Subtract(const Rectangle<int>& rect);
+    void Intersect(const Rectangle<int>& rect);
+    void Clear() { rects_.clear(); }
+
+    bool Empty() const { return rects_.empty(); }
+    bool Intersects(const Rectangle<int>& rect) const;
+    uint64_t Area() const;
+    Rectangle<int> Bounds() const;
+    const std::vector<Rectangle<int>>& Rects() const { return rects_; }
+
+  private:
+    std::vector<Rectangle<int>> rects_{};
+};
\ No newline at end of file
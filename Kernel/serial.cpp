@@ -0,0 +1,169 @@
+#include "serial.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include "asmfunc.h"
+#include "buffer_pool.hpp"
+#include "message.hpp"
+#include "sync.hpp"
+#include "task.hpp"
+
+namespace {
+  const uint16_t kCOM1 = 0x3F8;
+  // 各レジスタのオフセット
+  const uint16_t kData = 0;
+  const uint16_t kInterruptEnable = 1;
+  const uint16_t kFIFOControl = 2;
+  const uint16_t kLineControl = 3;
+  const uint16_t kModemControl = 4;
+  const uint16_t kLineStatus = 5;
+  // 送信バッファが空いたことを示す LSR のビット
+  const uint8_t kTransmitEmpty = 0x20;
+
+  bool available = false;
+
+  // 送信用のタスクへ渡したまま、まだ送り終えていないバッファの上限
+  const unsigned int kMaxQueuedBuffers = 8;
+
+  uint64_t serial_task_id = 0;
+  Mutex* serial_mutex;
+  Semaphore* serial_free_buffers;
+  // 書き込みをまとめているバッファ
+  bool pending = false;
+  uint32_t pending_handle;
+  size_t pending_bytes;
+
+  void WriteOut(const uint8_t* p, size_t bytes) {
+    for(size_t i = 0; i < bytes; ++i) {
+      while((IoIn8(kCOM1 + kLineStatus) & kTransmitEmpty) == 0);
+      IoOut8(kCOM1 + kData, p[i]);
+    }
+  }
+
+  // serial_mutex を持って呼ぶ。まとめているバッファの参照ごと送信用のタスクへ渡す
+  void SendPending() {
+    if(!pending) {
+      return;
+    }
+    pending = false;
+
+    Message msg{Message::kBuffer, task_manager->CurrentTask().ID()};
+    msg.arg.buffer.handle = pending_handle;
+    msg.arg.buffer.size = pending_bytes;
+    msg.arg.buffer.value = 0;
+    if(task_manager->SendMessage(serial_task_id, msg)) {
+      buffer_pool->Release(pending_handle);
+      serial_free_buffers->Up();
+    }
+  }
+
+  // 受け取ったバッファを、コピーせずにそのまま送り出す
+  void TaskSerial(uint64_t task_id, int64_t data) {
+    Task& task = task_manager->CurrentTask();
+    while(true) {
+      const auto msg = task.WaitMessage();
+      if(msg.type != Message::kBuffer) {
+        continue;
+      }
+
+      if(auto p = buffer_pool->Data(msg.arg.buffer.handle)) {
+        WriteOut(p, std::min<size_t>(msg.arg.buffer.size, BufferPool::kBufferBytes));
+      }
+      buffer_pool->Release(msg.arg.buffer.handle);
+      serial_free_buffers->Up();
+    }
+  }
+}
+
+void InitializeSerial() {
+  IoOut8(kCOM1 + kInterruptEnable, 0x00);  // 割り込みは使わない
+  IoOut8(kCOM1 + kLineControl, 0x80);      // 分周比を設定する
+  IoOut8(kCOM1 + kData, 0x01);             // 115200 / 1
+  IoOut8(kCOM1 + kInterruptEnable, 0x00);
+  IoOut8(kCOM1 + kLineControl, 0x03);      // 8N1
+  IoOut8(kCOM1 + kFIFOControl, 0xC7);      // FIFO を有効にして空にする
+
+  // ループバックで書いた値が読めれば、ポートがある
+  IoOut8(kCOM1 + kModemControl, 0x1E);
+  IoOut8(kCOM1 + kData, 0xAE);
+  if(IoIn8(kCOM1 + kData) != 0xAE) {
+    available = false;
+    return;
+  }
+
+  IoOut8(kCOM1 + kModemControl, 0x0F);
+  available = true;
+}
+
+bool SerialAvailable() {
+  return available;
+}
+
+void StartSerialTask() {
+  if(!available) {
+    return;
+  }
+
+  serial_mutex = new Mutex;
+  serial_free_buffers = new Semaphore{kMaxQueuedBuffers};
+  serial_task_id = task_manager->NewTask().InitContext(TaskSerial, 0).Wakeup().ID();
+}
+
+void SerialWrite(const void* data, size_t bytes) {
+  if(!available) {
+    return;
+  }
+
+  auto p = reinterpret_cast<const uint8_t*>(data);
+  if(serial_task_id == 0) {
+    WriteOut(p, bytes);
+    return;
+  }
+
+  MutexGuard lock{*serial_mutex};
+  while(bytes > 0) {
+    if(!pending) {
+      // 送信が追いつかないうちは、バッファが空くまで待つ
+      serial_free_buffers->Down();
+      auto [handle, err] = buffer_pool->Allocate();
+      if(err) {
+        // バッファを確保できないときは、渡し済みのバッファを送り終えるのを待ってから直接送る
+        for(unsigned int i = 1; i < kMaxQueuedBuffers; ++i) {
+          serial_free_buffers->Down();
+        }
+        WriteOut(p, bytes);
+        for(unsigned int i = 0; i < kMaxQueuedBuffers; ++i) {
+          serial_free_buffers->Up();
+        }
+        return;
+      }
+      pending = true;
+      pending_handle = handle;
+      pending_bytes = 0;
+    }
+
+    const size_t n = std::min(bytes, BufferPool::kBufferBytes - pending_bytes);
+    memcpy(buffer_pool->Data(pending_handle) + pending_bytes, p, n);
+    pending_bytes += n;
+    p += n;
+    bytes -= n;
+    if(pending_bytes == BufferPool::kBufferBytes) {
+      SendPending();
+    }
+  }
+}
+
+void SerialFlush() {
+  if(!available || serial_task_id == 0) {
+    return;
+  }
+
+  MutexGuard lock{*serial_mutex};
+  SendPending();
+}
+
+void SerialWrite(const char* s) {
+  SerialWrite(s, strlen(s));
+}
\ No newline at end of file
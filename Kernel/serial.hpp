@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+// COM1 を 115200bps、8 ビット、パリティなし、ストップビット 1 で使う。
+// ポートが見つからなければ、以後の書き込みは何もしない
+void InitializeSerial();
+bool SerialAvailable();
+// 以後の書き込みを BufferPool のバッファにまとめ、送信用のタスクへ Message::kBuffer で渡して
+// 書き込んだタスクを待たせずに送る。タスク管理の初期化後に呼ぶ。呼ぶまでは書き込んだその場で送る
+void StartSerialTask();
+void SerialWrite(const void* data, size_t bytes);
+void SerialWrite(const char* s);
+// まとめている途中の書き込みを送信用のタスクへ渡す。ひとまとまりの出力を書き終えたら呼ぶ
+void SerialFlush();
\ No newline at end of file
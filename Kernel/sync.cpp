@@ -0,0 +1,102 @@
+#include <algorithm>
+
+#include "sync.hpp"
+#include "task.hpp"
+#include "interrupt.hpp"
+
+void WaitQueue::Wait() {
+  InterruptGuard guard;
+  Task& current_task = task_manager->CurrentTask();
+  waiters_.push_back(&current_task);
+  task_manager->Sleep(&current_task);
+}
+
+void WaitQueue::WakeOne() {
+  InterruptGuard guard;
+  if(waiters_.empty()) {
+    return;
+  }
+
+  auto it = std::max_element(waiters_.begin(), waiters_.end(),
+    [](const Task* lhs, const Task* rhs) { return lhs->Level() < rhs->Level(); });
+  Task* task = *it;
+  waiters_.erase(it);
+  task_manager->Wakeup(task);
+}
+
+void WaitQueue::WakeAll() {
+  InterruptGuard guard;
+  while(!waiters_.empty()) {
+    task_manager->Wakeup(waiters_.front());
+    waiters_.pop_front();
+  }
+}
+
+void Mutex::Lock() {
+  // タスク管理の初期化前はタスクが1つしかないので排他は不要
+  if(task_manager == nullptr) {
+    return;
+  }
+
+  InterruptGuard guard;
+  Task* current_task = &task_manager->CurrentTask();
+  if(owner_ == current_task) {
+    depth_++;
+    return;
+  }
+
+  while(owner_ != nullptr) {
+    if(current_task->Level() > owner_->Level()) {
+      task_manager->ChangeLevel(owner_, current_task->Level());
+    }
+    waiters_.Wait();
+  }
+
+  owner_ = current_task;
+  depth_ = 1;
+  owner_level_ = current_task->Level();
+}
+
+void Mutex::Unlock() {
+  InterruptGuard guard;
+  if(owner_ == nullptr) {
+    return;
+  }
+
+  if(--depth_ > 0) {
+    return;
+  }
+
+  Task* owner = owner_;
+  owner_ = nullptr;
+  waiters_.WakeOne();
+
+  // 引き上げたレベルを戻し、待っていた高レベルのタスクにすぐCPUを譲る
+  if(owner->Level() != owner_level_) {
+    task_manager->ChangeLevel(owner, owner_level_);
+    task_manager->Yield();
+  }
+}
+
+void Semaphore::Down() {
+  InterruptGuard guard;
+  while(count_ == 0) {
+    waiters_.Wait();
+  }
+  count_--;
+}
+
+bool Semaphore::TryDown() {
+  InterruptGuard guard;
+  if(count_ == 0) {
+    return false;
+  }
+  count_--;
+  return true;
+}
+
+void Semaphore::Up() {
+  InterruptGuard guard;
+  count_++;
+  waiters_.WakeOne();
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+
+#include "task.hpp"
+
+// スリープしてイベントを待つタスクの待ち行列
+class WaitQueue {
+  public:
+    // 実行中のタスクを待ち行列に入れてスリープする。
+    // 待つ条件の確認からWaitまでを割り込み禁止で行わないと起床を取りこぼす
+    void Wait();
+    // 最もレベルの高い待ちタスクを1つ起こす
+    void WakeOne();
+    void WakeAll();
+    bool Empty() const { return waiters_.empty(); }
+
+  private:
+    std::deque<Task*> waiters_{};
+};
+
+// 獲得できなければスリープするミューテックス。
+// 同じタスクからの再帰的なLockを許す。
+// 高いレベルのタスクが待たされた場合、所有者のレベルを一時的に引き上げる（優先度継承）
+class Mutex {
+  public:
+    void Lock();
+    void Unlock();
+
+  private:
+    Task* owner_{nullptr};
+    unsigned int depth_{0};
+    unsigned int owner_level_{0};
+    WaitQueue waiters_{};
+};
+
+class MutexGuard {
+  public:
+    MutexGuard(Mutex& mutex) : mutex_{mutex} { mutex_.Lock(); }
+    ~MutexGuard() { mutex_.Unlock(); }
+    MutexGuard(const MutexGuard&) = delete;
+    MutexGuard& operator=(const MutexGuard&) = delete;
+
+  private:
+    Mutex& mutex_;
+};
+
+class Semaphore {
+  public:
+    Semaphore(unsigned int count = 0) : count_{count} {}
+    void Down();
+    bool TryDown();
+    void Up();
+    unsigned int Count() const { return count_; }
+
+  private:
+    unsigned int count_;
+    WaitQueue waiters_{};
+};
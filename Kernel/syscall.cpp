@@ -1,6 +1,9 @@
 #include <array>
+#include <map>
 #include <cstdint>
 #include <cerrno>
+#include <optional>
+#include <vector>
 
 #include "syscall.hpp"
 #include "task.hpp"
@@ -10,12 +13,215 @@
 #include "asmfunc.h"
 #include "msr.hpp"
 #include "logger.hpp"
+#include "paging.hpp"
+#include "region.hpp"
+#include "sync.hpp"
 
 struct Result {
   uint64_t value;
   int error;
 };
 
+namespace {
+  // アプリへ共有するウィンドウのバッファを置く仮想アドレス。アプリの ELF と同じ PML4 エントリの中なので、
+  // アプリの終了時に CleanPageMaps でまとめて外れる。レイヤ ID ごとに kSurfaceSlotBytes ずつ使う
+  const uint64_t kSurfaceAreaBase = 0xFFFF'8040'0000'0000;
+  const uint64_t kSurfaceSlotBytes = 64 * 1024 * 1024;
+  const uint64_t kSurfaceSlotCount = 4096;
+  const size_t kPageBytes = 4096;
+  // 1回の WinPresent で受け取る矩形の上限
+  const size_t kMaxPresentRects = 64;
+
+  // アプリ側の syscall.h と同じ並び
+  struct WindowSurface {
+    uint32_t* pixels;
+    int width, height;
+    int pixels_per_scanline;
+    int pixel_format;
+  };
+
+  struct SurfaceRect {
+    int x, y, width, height;
+  };
+
+  // WinDraw で受け取る描画命令。並びはアプリ側の syscall.h と同じ。
+  // 各命令は DrawCommandHeader で始まり、size は見出しを含むバイト数（4 の倍数）
+  enum DrawCommandType : uint16_t {
+    kDrawFillRect = 1,
+    kDrawLine = 2,
+    kDrawText = 3,
+    kDrawBlit = 4,
+  };
+
+  struct DrawCommandHeader {
+    uint16_t type;
+    uint16_t size;
+  };
+
+  struct DrawFillRect {
+    DrawCommandHeader header;
+    int x, y, width, height;
+    uint32_t color;
+  };
+
+  struct DrawLineCommand {
+    DrawCommandHeader header;
+    int x0, y0, x1, y1;
+    uint32_t color;
+  };
+
+  // text には length バイトの文字が続く。flags の bit 0 が立っていれば bg で背景も塗る
+  struct DrawText {
+    DrawCommandHeader header;
+    int x, y;
+    uint32_t color, bg;
+    uint32_t flags;
+    uint32_t length;
+    char text[];
+  };
+
+  // pixels は r, g, b, a の順に 4 バイトずつ並ぶ画素で、1行は stride 画素
+  struct DrawBlit {
+    DrawCommandHeader header;
+    int x, y, width, height;
+    int stride;
+    uint32_t reserved;
+    uint64_t pixels;
+  };
+
+  const size_t kMaxDrawBufferBytes = 64 * 1024;
+  const uint32_t kMaxDrawTextLength = 256;
+  // 座標はこの範囲に収まるものだけ受け付ける。長すぎる線などで時間を取られないように
+  const int kMaxDrawCoord = 16384;
+  // アプリに割り当てる仮想アドレスは上位半分だけ
+  const uint64_t kUserAddressBase = 0xFFFF'8000'0000'0000;
+
+  // アプリから渡されたアドレスの範囲が上位半分にあり、すべてのページがアプリに割り当てられているか。
+  // 割り当てられていないページに触るとカーネルの中でページフォルトになるので、触る前に確かめる
+  bool IsUserRange(uint64_t addr, uint64_t bytes, bool writable = false) {
+    return addr >= kUserAddressBase && IsUserAccessible(addr, bytes, writable);
+  }
+
+  // NUL で終わる文字列が max_length バイト以内で、すべてアプリから読めるか
+  bool IsUserString(uint64_t addr, size_t max_length) {
+    for(size_t i = 0; i < max_length; ) {
+      // ページごとに確かめてから、そのページの中で NUL を探す
+      const size_t n = std::min<size_t>(kPageBytes - (addr + i) % kPageBytes, max_length - i);
+      if(!IsUserRange(addr + i, n)) {
+        return false;
+      }
+      if(memchr(reinterpret_cast<const void*>(addr + i), '\0', n)) {
+        return true;
+      }
+      i += n;
+    }
+    return false;
+  }
+
+  // OpenWindow や OpenWindowSurface で開いたレイヤと、開いたタスク。
+  // ウィンドウへの描画はこのタスクからしか受け付けない
+  std::map<unsigned int, uint64_t>* window_owners;
+  Mutex* window_owners_mutex;
+
+  void SetWindowOwner(unsigned int layer_id) {
+    MutexGuard lock{*window_owners_mutex};
+    (*window_owners)[layer_id] = task_manager->CurrentTask().ID();
+  }
+
+  // ほかのタスクのウィンドウや、ターミナルなどカーネルのウィンドウは描き換えさせない
+  bool IsWindowOwner(unsigned int layer_id) {
+    const auto task_id = task_manager->CurrentTask().ID();
+    MutexGuard lock{*window_owners_mutex};
+    auto it = window_owners->find(layer_id);
+    return it != window_owners->end() && it->second == task_id;
+  }
+
+  bool IsValidCoord(int v) {
+    return -kMaxDrawCoord <= v && v <= kMaxDrawCoord;
+  }
+
+  bool IsValidRect(int x, int y, int w, int h) {
+    return IsValidCoord(x) && IsValidCoord(y) && 0 <= w && w <= kMaxDrawCoord && 0 <= h && h <= kMaxDrawCoord;
+  }
+
+  // 命令 1 つを検査し、描画される範囲（ウィンドウ内の座標）を返す。不正なら nullopt
+  std::optional<Rectangle<int>> CheckDrawCommand(const DrawCommandHeader* cmd) {
+    switch(cmd->type) {
+      case kDrawFillRect: {
+        auto c = reinterpret_cast<const DrawFillRect*>(cmd);
+        if(cmd->size != sizeof(DrawFillRect) || !IsValidRect(c->x, c->y, c->width, c->height)) {
+          return std::nullopt;
+        }
+        return Rectangle<int>{{c->x, c->y}, {c->width, c->height}};
+      }
+      case kDrawLine: {
+        auto c = reinterpret_cast<const DrawLineCommand*>(cmd);
+        if(cmd->size != sizeof(DrawLineCommand) ||
+           !IsValidCoord(c->x0) || !IsValidCoord(c->y0) || !IsValidCoord(c->x1) || !IsValidCoord(c->y1)) {
+          return std::nullopt;
+        }
+        const Vector2D<int> pos{std::min(c->x0, c->x1), std::min(c->y0, c->y1)};
+        return Rectangle<int>{pos, Vector2D<int>{std::max(c->x0, c->x1) + 1, std::max(c->y0, c->y1) + 1} - pos};
+      }
+      case kDrawText: {
+        auto c = reinterpret_cast<const DrawText*>(cmd);
+        if(cmd->size < sizeof(DrawText) || c->length > kMaxDrawTextLength ||
+           cmd->size != (sizeof(DrawText) + c->length + 3) / 4 * 4 || !IsValidRect(c->x, c->y, 0, 0)) {
+          return std::nullopt;
+        }
+        return Rectangle<int>{{c->x, c->y}, {8 * static_cast<int>(c->length), 16}};
+      }
+      case kDrawBlit: {
+        auto c = reinterpret_cast<const DrawBlit*>(cmd);
+        if(cmd->size != sizeof(DrawBlit) || !IsValidRect(c->x, c->y, c->width, c->height) ||
+           c->stride < c->width || c->stride > kMaxDrawCoord) {
+          return std::nullopt;
+        }
+        const uint64_t pixels = c->height == 0 ? 0 : static_cast<uint64_t>(c->stride) * (c->height - 1) + c->width;
+        if(!IsUserRange(c->pixels, pixels * sizeof(PixelColor))) {
+          return std::nullopt;
+        }
+        return Rectangle<int>{{c->x, c->y}, {c->width, c->height}};
+      }
+      default:
+        return std::nullopt;
+    }
+  }
+
+  void ExecuteDrawCommand(PixelWriter& writer, const DrawCommandHeader* cmd) {
+    switch(cmd->type) {
+      case kDrawFillRect: {
+        auto c = reinterpret_cast<const DrawFillRect*>(cmd);
+        writer.FillRect({{c->x, c->y}, {c->width, c->height}}, ToColor(c->color));
+        break;
+      }
+      case kDrawLine: {
+        auto c = reinterpret_cast<const DrawLineCommand*>(cmd);
+        DrawLine(writer, {c->x0, c->y0}, {c->x1, c->y1}, ToColor(c->color));
+        break;
+      }
+      case kDrawText: {
+        auto c = reinterpret_cast<const DrawText*>(cmd);
+        char s[kMaxDrawTextLength + 1];
+        memcpy(s, c->text, c->length);
+        s[c->length] = '\0';
+        if(c->flags & 1) {
+          WriteString(writer, {c->x, c->y}, s, ToColor(c->color), ToColor(c->bg));
+        } else {
+          WriteString(writer, {c->x, c->y}, s, ToColor(c->color));
+        }
+        break;
+      }
+      case kDrawBlit: {
+        auto c = reinterpret_cast<const DrawBlit*>(cmd);
+        writer.BlitRect({c->x, c->y}, reinterpret_cast<const PixelColor*>(c->pixels),
+                        {c->width, c->height}, c->stride);
+        break;
+      }
+    }
+  }
+}
+
 #define SYSCALL(name) \
   Result name( \
     uint64_t arg1, uint64_t arg2, uint64_t arg3, \
@@ -47,7 +253,12 @@ SYSCALL(PutString) {
 
   if(fd == 1) {
     const auto task_id = task_manager->CurrentTask().ID();
-    (*terminals)[task_id]->Print(s, len);
+    Terminal* terminal;
+    {
+      MutexGuard lock{*terminals_mutex};
+      terminal = (*terminals)[task_id];
+    }
+    terminal->Print(s, len);
     return {len, 0};
   }
 
@@ -55,9 +266,7 @@ SYSCALL(PutString) {
 }
 
 SYSCALL(Exit) {
-  __asm__("cli");
   auto& task = task_manager->CurrentTask();
-  __asm__("sti");
 
   return { task.OSStackPointer(), static_cast<int>(arg1) }; 
 }
@@ -65,16 +274,15 @@ SYSCALL(Exit) {
 SYSCALL(OpenWindow) {
   const int w = arg1, h = arg2, x = arg3, y = arg4;
   const auto title = reinterpret_cast<const char*>(arg5);
-  const auto win = std::make_shared<ToplevelWindow>(w, h, screen_config.pixel_format, title);
+  const auto win = std::make_shared<ToplevelWindow>(w, h, window_pixel_format, title);
 
-  __asm__("cli");
   const auto layer_id  = layer_manager->NewLayer()
     .SetWindow(win)
     .SetDraggable(true)
     .Move({x, y})
     .ID();
+  SetWindowOwner(layer_id);
   active_layer->Activate(layer_id);
-  __asm__("sti");
 
   return { layer_id, 0 };
 }
@@ -85,34 +293,196 @@ SYSCALL(WinWriteString) {
   const uint32_t color = arg4;
   const char* msg = reinterpret_cast<const char*>(arg5);
 
-  __asm__("cli");
+  // デスクトップのように Window を持たないレイヤには書けない
   auto layer = layer_manager->FindLayer(layer_id);
-  __asm__("sti");
-  if(layer == nullptr) {
+  if(layer == nullptr || !layer->GetWindow() || !IsWindowOwner(layer_id)) {
     return { 0, EBADF };
   }
 
   WriteString(*layer->GetWindow()->Writer(), {x, y}, msg, ToColor(color));
-  __asm__("cli");
-  layer_manager->Draw(layer_id);
-  __asm__("sti");
+  layer_manager->Invalidate(layer_id);
 
   return { 0, 0 };
 }
 
+SYSCALL(OpenWindowSurface) {
+  const int w = arg1, h = arg2, x = arg3, y = arg4;
+  const auto title = reinterpret_cast<const char*>(arg5);
+  const auto surface = reinterpret_cast<WindowSurface*>(arg6);
+  if(!IsUserRange(arg6, sizeof(WindowSurface), true) || !IsUserString(arg5, 256)) {
+    return { 0, EFAULT };
+  }
+  if(w <= 0 || h <= 0) {
+    return { 0, EINVAL };
+  }
+  // 大きすぎるバッファを確保しないよう、作る前にも大まかに確かめておく
+  const uint64_t win_w = static_cast<uint64_t>(w) + ToplevelWindow::kMarginX;
+  const uint64_t win_h = static_cast<uint64_t>(h) + ToplevelWindow::kMarginY;
+  if(win_w * win_h * 4 > kSurfaceSlotBytes) {
+    return { 0, EINVAL };
+  }
+
+  // ページ単位でアプリへ見せるので、バッファの先頭と大きさをページ境界に揃える
+  const auto win = std::make_shared<ToplevelWindow>(
+    static_cast<int>(win_w), static_cast<int>(win_h), window_pixel_format, title, kPageBytes);
+
+  const auto layer_id = layer_manager->NewLayer()
+    .SetWindow(win)
+    .SetDraggable(true)
+    .Move({x, y})
+    .ID();
+  if(layer_id >= kSurfaceSlotCount) {
+    layer_manager->RemoveLayer(layer_id);
+    return { 0, ENOMEM };
+  }
+
+  // カーネルのメモリは恒等写像なので、バッファの仮想アドレスがそのまま物理アドレスになる。
+  // 1行は切り上げてあるので、実際の行の長さとページ数でスロットに収まるかを確かめる
+  auto& buffer = win->Buffer();
+  const auto phys_addr = reinterpret_cast<uintptr_t>(buffer.PixelAt({0, 0}));
+  const uint64_t num_pages =
+    (static_cast<uint64_t>(buffer.BytesPerScanLine()) * win_h + kPageBytes - 1) / kPageBytes;
+  if(num_pages * kPageBytes > kSurfaceSlotBytes) {
+    layer_manager->RemoveLayer(layer_id);
+    return { 0, EINVAL };
+  }
+  const uint64_t surface_addr = kSurfaceAreaBase + layer_id * kSurfaceSlotBytes;
+  if(auto err = MapSharedPages(LinearAddress4Level{surface_addr}, phys_addr, num_pages)) {
+    layer_manager->RemoveLayer(layer_id);
+    return { 0, ENOMEM };
+  }
+
+  const int bytes_per_pixel = 4;
+  const auto inner_pos = ToplevelWindow::kTopLeftMargin;
+  surface->pixels = reinterpret_cast<uint32_t*>(
+    surface_addr + inner_pos.y * buffer.BytesPerScanLine() + inner_pos.x * bytes_per_pixel);
+  surface->width = w;
+  surface->height = h;
+  surface->pixels_per_scanline = buffer.BytesPerScanLine() / bytes_per_pixel;
+  surface->pixel_format = window_pixel_format;
+
+  SetWindowOwner(layer_id);
+  active_layer->Activate(layer_id);
+  return { layer_id, 0 };
+}
+
+SYSCALL(WinPresent) {
+  const unsigned int layer_id = arg1;
+  const auto rects = reinterpret_cast<const SurfaceRect*>(arg2);
+  const size_t num_rects = arg3;
+  if(num_rects > kMaxPresentRects) {
+    return { 0, E2BIG };
+  }
+  if(num_rects > 0 && !IsUserRange(arg2, num_rects * sizeof(SurfaceRect))) {
+    return { 0, EFAULT };
+  }
+
+  auto layer = layer_manager->FindLayer(layer_id);
+  if(layer == nullptr || !layer->GetWindow() || !IsWindowOwner(layer_id)) {
+    return { 0, EBADF };
+  }
+
+  const auto win = layer->GetWindow();
+  const auto inner_pos = ToplevelWindow::kTopLeftMargin;
+  const Rectangle<int> inner_area{
+    inner_pos, win->Size() - inner_pos - ToplevelWindow::kBottomRightMargin};
+
+  // 矩形がなければ内側全体が変わったものとする
+  if(num_rects == 0) {
+    win->MarkDirty(inner_area.pos.y, inner_area.size.y);
+    layer_manager->Invalidate(layer_id, inner_area);
+    return { 0, 0 };
+  }
+
+  for(size_t i = 0; i < num_rects; ++i) {
+    const Rectangle<int> rect{
+      Vector2D<int>{rects[i].x, rects[i].y} + inner_pos, {rects[i].width, rects[i].height}};
+    const auto area = rect & inner_area;
+    if(IsEmpty(area)) {
+      continue;
+    }
+    win->MarkDirty(area.pos.y, area.size.y);
+    layer_manager->Invalidate(layer_id, area);
+  }
+
+  return { 0, 0 };
+}
+
+SYSCALL(WinDraw) {
+  const unsigned int layer_id = arg1;
+  const size_t bytes = arg3;
+  if(bytes > kMaxDrawBufferBytes) {
+    return { 0, E2BIG };
+  }
+  if(!IsUserRange(arg2, bytes) || arg2 % 4 != 0) {
+    return { 0, EFAULT };
+  }
+
+  auto layer = layer_manager->FindLayer(layer_id);
+  if(layer == nullptr || !layer->GetWindow() || !IsWindowOwner(layer_id)) {
+    return { 0, EBADF };
+  }
+
+  // 命令の列はアプリのウィンドウのバッファに置くこともできるので、前の命令の描画で後の命令が書き換わりうる。
+  // カーネル側へ写してから、写したものだけを検査して実行する
+  std::vector<uint32_t> commands((bytes + 3) / 4);
+  memcpy(commands.data(), reinterpret_cast<const void*>(arg2), bytes);
+  const auto buf = reinterpret_cast<uintptr_t>(commands.data());
+  const auto win = layer->GetWindow();
+  const Rectangle<int> win_area{{0, 0}, win->Size()};
+
+  // 先に全体を検査して、途中までしか描かれないことがないようにする
+  Region damage;
+  size_t num_commands = 0;
+  for(size_t offset = 0; offset < bytes; ) {
+    if(bytes - offset < sizeof(DrawCommandHeader)) {
+      return { num_commands, EINVAL };
+    }
+    auto cmd = reinterpret_cast<const DrawCommandHeader*>(buf + offset);
+    if(cmd->size < sizeof(DrawCommandHeader) || cmd->size % 4 != 0 || cmd->size > bytes - offset) {
+      return { num_commands, EINVAL };
+    }
+    const auto area = CheckDrawCommand(cmd);
+    if(!area) {
+      return { num_commands, EINVAL };
+    }
+    damage.Add(*area & win_area);
+    offset += cmd->size;
+    ++num_commands;
+  }
+
+  auto& writer = *win->Writer();
+  for(size_t offset = 0; offset < bytes; ) {
+    auto cmd = reinterpret_cast<const DrawCommandHeader*>(buf + offset);
+    ExecuteDrawCommand(writer, cmd);
+    offset += cmd->size;
+  }
+
+  for(const auto& rect : damage.Rects()) {
+    layer_manager->Invalidate(layer_id, rect);
+  }
+  return { num_commands, 0 };
+}
+
 #undef SYSCALL
 
 using SyscallFuncType = Result (uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t);
 
-extern "C" std::array<SyscallFuncType*, 5> syscall_table{
+extern "C" std::array<SyscallFuncType*, 8> syscall_table{
   LogString,
   PutString,
   Exit,
   OpenWindow,
   WinWriteString,
+  OpenWindowSurface,
+  WinPresent,
+  WinDraw,
 };
 
 void InitializeSyscall() {
+  window_owners = new std::map<unsigned int, uint64_t>;
+  window_owners_mutex = new Mutex;
+
   WriteMSR(kIA32_EFER, 0x0501u);
   WriteMSR(kIA32_LSTAR, reinterpret_cast<uint64_t>(SyscallEntry));
   WriteMSR(kIA32_STAR, static_cast<uint64_t>(8) << 32 | static_cast<uint64_t>(16 | 3) << 48);
@@ -2,6 +2,7 @@
 
 #include "task.hpp"
 #include "timer.hpp"
+#include "interrupt.hpp"
 #include "segment.hpp"
 #include "error.hpp"
 #include "logger.hpp"
@@ -10,10 +11,8 @@
 void InitializeTask() {
   task_manager = new TaskManager;
 
-  __asm__("cli");
   auto period = timer_manager->CurrentTick() + kTaskTimerPeriod;
   timer_manager->AddTimer(Timer{period, kTaskTimerValue});
-  __asm__("sti");
 }
 
 template <class T, class U>
@@ -75,18 +74,37 @@ Task& Task::Wakeup() {
   return *this;
 }
 
+// メールボックスは割り込みハンドラからも操作されるため、割り込み禁止で保護する
 void Task::SendMessage(const Message& message) {  
+  InterruptGuard guard;
   messages_.push_back(message);    
   Wakeup();
 }
 
 std::optional<Message> Task::ReceiveMessage() {  
+  InterruptGuard guard;
   if(messages_.empty()) {    
     return std::nullopt;
   }  
 
   auto m = messages_.front();
   messages_.pop_front();
+  stats_.messages++;
+  return m;
+}
+
+// メッセージが届くまでスリープする。
+// 空かどうかの確認からスリープまでの間に届いたメッセージを取りこぼさないよう、
+// 全体を割り込み禁止で行う
+Message Task::WaitMessage() {
+  InterruptGuard guard;
+  while(messages_.empty()) {
+    Sleep();
+  }
+
+  auto m = messages_.front();
+  messages_.pop_front();
+  stats_.messages++;
   return m;
 }
 
@@ -95,9 +113,12 @@ uint64_t& Task::OSStackPointer() {
 }
 
 TaskManager::TaskManager() {
+  const auto now = ReadTSC();
+
   Task& task = NewTask()
     .SetLevel(current_level_)
     .SetRunning(true);
+  task.last_switch_tsc_ = now;
 
   running_[current_level_].push_back(&task);
 
@@ -105,15 +126,18 @@ TaskManager::TaskManager() {
     .InitContext(TaskIdle, 0)
     .SetLevel(0)
     .SetRunning(true);
+  idle.last_switch_tsc_ = now;
   running_[0].push_back(&idle);
 }
 
 Task& TaskManager::NewTask() {
+  InterruptGuard guard;
   latest_id_++;
   return *tasks_.emplace_back(new Task{latest_id_});
 }
 
 Task& TaskManager::CurrentTask() {
+  InterruptGuard guard;
   return *running_[current_level_].front();
 }
 
@@ -150,11 +174,13 @@ void TaskManager::SwitchTask(const TaskContext& context) {
   Task* current_task = RotateRunQueue(false);
   Task* next_task = &CurrentTask();
   if(next_task != current_task) {
+    AccountSwitch(current_task, next_task);
     RestoreContext(&next_task->Context());  
   }
 }
 
 Error TaskManager::SendMessage(uint64_t id, const Message& message) {
+  InterruptGuard guard;
   auto it = std::find_if(tasks_.begin(), tasks_.end(), [id](const auto& task) { return task->ID() == id; });
   
   if(it == tasks_.end()) {
@@ -165,7 +191,109 @@ Error TaskManager::SendMessage(uint64_t id, const Message& message) {
   return MAKE_ERROR(Error::kSuccess);
 }
 
+Task* TaskManager::FindTask(uint64_t id) {
+  auto it = std::find_if(tasks_.begin(), tasks_.end(), [id](const auto& task) { return task->ID() == id; });
+  if(it == tasks_.end()) {
+    return nullptr;
+  }
+
+  return it->get();
+}
+
+// メッセージを送信し、返信が来るまで待つ。
+// 受信側がメッセージ待ちでスリープしていれば、実行キューを回さずに直接切り替える
+WithError<Message> TaskManager::Call(uint64_t id, const Message& message) {
+  InterruptGuard guard;
+  Task* receiver = FindTask(id);
+  Task* current_task = running_[current_level_].front();
+  if(receiver == nullptr || receiver == current_task) {
+    return { Message{}, MAKE_ERROR(Error::kNoSuchTask) };
+  }
+
+  Message request = message;
+  request.src_task = current_task->ID();
+  request.seq = ++last_call_seq_;
+  receiver->messages_.push_back(request);
+
+  current_task->waiting_seq_ = request.seq;
+  current_task->reply_.reset();
+  if(!receiver->Running()) {
+    Handoff(receiver, true);
+  }
+
+  while(!current_task->reply_) {
+    Sleep(current_task);
+  }
+
+  auto reply = *current_task->reply_;
+  current_task->reply_.reset();
+  current_task->stats_.messages++;
+  return { reply, MAKE_ERROR(Error::kSuccess) };
+}
+
+// Call で request の返信を待っているタスクに返信し、そのタスクへ直接切り替える。
+// 相手が待っていない、あるいは別の要求の返信を待っているなら、通常のメッセージとして送る
+Error TaskManager::Reply(const Message& request, const Message& message) {
+  InterruptGuard guard;
+  Task* caller = FindTask(request.src_task);
+  if(caller == nullptr) {
+    return MAKE_ERROR(Error::kNoSuchTask);
+  }
+
+  Message reply = message;
+  reply.seq = request.seq;
+  if(request.seq == 0 || caller->waiting_seq_ != request.seq) {
+    caller->SendMessage(reply);
+    return MAKE_ERROR(Error::kSuccess);
+  }
+
+  caller->waiting_seq_ = 0;
+  caller->reply_ = reply;
+
+  Task* current_task = running_[current_level_].front();
+  if(current_task->messages_.empty()) {
+    Handoff(caller, false);
+  } else {
+    Wakeup(caller);
+  }
+
+  return MAKE_ERROR(Error::kSuccess);
+}
+
+// RotateRunQueue を経由せずに next へ切り替える。
+// 実行中のタスクは current_sleep ならスリープし、そうでなければ同じレベルの末尾に回る
+void TaskManager::Handoff(Task* next, bool current_sleep) {
+  const auto now = ReadTSC();
+  auto& current_queue = running_[current_level_];
+  Task* current_task = current_queue.front();
+  current_queue.pop_front();
+  if(current_sleep) {
+    current_task->SetRunning(false);
+  } else {
+    current_queue.push_back(current_task);
+  }
+
+  if(next->Running()) {
+    Erase(running_[next->Level()], next);
+  } else {
+    next->SetRunning(true);
+    next->stats_.wakeups++;
+    next->last_switch_tsc_ = now;
+  }
+
+  running_[next->Level()].push_front(next);
+  // 次の切り替え時にはレベルの高いタスクを改めて探させる
+  if(next->Level() != current_level_) {
+    current_level_ = next->Level();
+    level_changed_ = true;
+  }
+
+  AccountSwitch(current_task, next);
+  SwitchContext(&next->Context(), &current_task->Context());
+}
+
 void TaskManager::Sleep(Task* task) {
+  InterruptGuard guard;
   if(!task->Running()) {
     return;
   }
@@ -174,8 +302,9 @@ void TaskManager::Sleep(Task* task) {
 
   if(task == running_[current_level_].front()) {
     Task* current_task = RotateRunQueue(true);
-    TaskContext* next_ctx = &CurrentTask().Context();
-    SwitchContext(next_ctx, &current_task->Context());
+    Task* next_task = &CurrentTask();
+    AccountSwitch(current_task, next_task);
+    SwitchContext(&next_task->Context(), &current_task->Context());
 
     return;
   }
@@ -184,6 +313,7 @@ void TaskManager::Sleep(Task* task) {
 }
 
 void TaskManager::Wakeup(Task* task, int level) {
+  InterruptGuard guard;
   if(task->Running()) {
     ChangeLevelRunning(task, level);
     return;
@@ -195,6 +325,8 @@ void TaskManager::Wakeup(Task* task, int level) {
 
   task->SetLevel(level);
   task->SetRunning(true);
+  task->stats_.wakeups++;
+  task->last_switch_tsc_ = ReadTSC();
 
   running_[level].push_back(task);
   if(level > current_level_) {
@@ -210,7 +342,7 @@ void TaskManager::ChangeLevelRunning(Task* task, int level) {
   }
 
   if(task != running_[current_level_].front()) {
-    Erase(running_[current_level_], task);
+    Erase(running_[task->Level()], task);
     running_[level].push_back(task);
     task->SetLevel(level);
     if(level > current_level_) {
@@ -230,6 +362,7 @@ void TaskManager::ChangeLevelRunning(Task* task, int level) {
 }
 
 Error TaskManager::Sleep(uint64_t id) {
+  InterruptGuard guard;
   auto it = std::find_if(tasks_.begin(), tasks_.end(), [id](const auto& task) { return task->ID() == id; });
 
   if(it == tasks_.end()) {
@@ -241,6 +374,7 @@ Error TaskManager::Sleep(uint64_t id) {
 }
 
 Error TaskManager::Wakeup(uint64_t id, int level) {
+  InterruptGuard guard;
   auto it = std::find_if(tasks_.begin(), tasks_.end(), [id](const auto& task) { return task->ID() == id; });
 
   if(it == tasks_.end()) {
@@ -249,4 +383,61 @@ Error TaskManager::Wakeup(uint64_t id, int level) {
 
   Wakeup(it->get(), level);
   return MAKE_ERROR(Error::kSuccess);
+}
+
+// スリープ中のタスクは起こさずにレベルだけを変更する
+void TaskManager::ChangeLevel(Task* task, int level) {
+  InterruptGuard guard;
+  if(task->Running()) {
+    ChangeLevelRunning(task, level);
+  } else if(level >= 0) {
+    task->SetLevel(level);
+  }
+}
+
+// 実行可能な他のタスクにCPUを譲る
+void TaskManager::Yield() {
+  InterruptGuard guard;
+  Task* current_task = RotateRunQueue(false);
+  Task* next_task = &CurrentTask();
+  if(next_task != current_task) {
+    AccountSwitch(current_task, next_task);
+    SwitchContext(&next_task->Context(), &current_task->Context());
+  }
+}
+
+std::vector<TaskStatus> TaskManager::Statistics() const {
+  InterruptGuard guard;
+  const auto now = ReadTSC();
+  const Task* current_task = running_[current_level_].front();
+
+  std::vector<TaskStatus> result;
+  result.reserve(tasks_.size());
+  for(const auto& task : tasks_) {
+    TaskStatus status{task->ID(), task->Level(), task->Running(), task->stats_};
+    // 実行中のタスクは最後に切り替わってからの時間も含める
+    if(task.get() == current_task) {
+      status.stats.runtime += now - task->last_switch_tsc_;
+    }
+    result.push_back(status);
+  }
+
+  return result;
+}
+
+// タスク切り替えの時点で両タスクの実行時間と待ち時間を記録する
+void TaskManager::AccountSwitch(Task* prev, Task* next) {
+  const auto now = ReadTSC();
+
+  prev->stats_.runtime += now - prev->last_switch_tsc_;
+  prev->last_switch_tsc_ = now;
+
+  next->stats_.wait_time += now - next->last_switch_tsc_;
+  next->stats_.switches++;
+  next->last_switch_tsc_ = now;
+
+  // 割り込み許可状態で中断されたタスクへ切り替わる場合、割り込み禁止区間はここで終わる
+  if(next->context_.rflags & 0x200) {
+    interrupt_off_tracker.End();
+  }
 }
\ No newline at end of file
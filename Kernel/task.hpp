@@ -21,6 +21,22 @@ struct TaskContext {
   std::array<uint8_t, 512> fxsave_area;
 } __attribute__((packed));
 
+// タスクごとのCPU使用状況。時間はすべてTSCのカウント値
+struct TaskStatistics {
+  uint64_t runtime{0};    // CPU上で実行していた時間
+  uint64_t wait_time{0};  // 実行可能状態だがランキューで待たされていた時間
+  uint64_t switches{0};   // CPUを割り当てられた回数
+  uint64_t wakeups{0};    // スリープ状態から起床した回数
+  uint64_t messages{0};   // 受信したメッセージ数
+};
+
+struct TaskStatus {
+  uint64_t id;
+  unsigned int level;
+  bool running;
+  TaskStatistics stats;
+};
+
 class Task {
   public:
     static const int kDefaultLevel = 1;
@@ -36,7 +52,9 @@ class Task {
     Task& Wakeup();
     void SendMessage(const Message& message);
     std::optional<Message> ReceiveMessage();
+    Message WaitMessage();
     uint64_t& OSStackPointer();
+    const TaskStatistics& Statistics() const { return stats_; }
 
   private:
     uint64_t id_;
@@ -46,6 +64,12 @@ class Task {
     std::deque<Message> messages_{};
     unsigned int level_{kDefaultLevel};
     bool running_{false};
+    TaskStatistics stats_{};
+    // TaskManager::Call で返信を待っている間に使う。waiting_seq_ は待っている要求の番号で、待っていなければ 0
+    uint64_t waiting_seq_{0};
+    std::optional<Message> reply_{std::nullopt};
+    // 実行中ならCPUを割り当てられた時刻、実行待ちならランキューに入った時刻
+    uint64_t last_switch_tsc_{0};
 
     Task& SetLevel(int level) { level_ = level; return *this; };
     Task& SetRunning(bool running) { running_ = running; return *this; };
@@ -63,20 +87,30 @@ class TaskManager {
     void SwitchTask(const TaskContext& context);
     Task& CurrentTask();
     Error SendMessage(uint64_t id, const Message& message);    
+    WithError<Message> Call(uint64_t id, const Message& message);
+    // request に対する返信を、request を送ってきたタスクに送る
+    Error Reply(const Message& request, const Message& message);
 
     void Sleep(Task* task);
     Error Sleep(uint64_t id);
     void Wakeup(Task* task, int level = -1);
     Error Wakeup(uint64_t id, int level = -1);
+    void ChangeLevel(Task* task, int level);
+    void Yield();
+    std::vector<TaskStatus> Statistics() const;
 
   private:
     std::vector<std::unique_ptr<Task>> tasks_{};
     uint64_t latest_id_{0};
+    uint64_t last_call_seq_{0};
     std::array<std::deque<Task*>, kMaxLevel + 1> running_{};
     int current_level_{kMaxLevel};
     bool level_changed_{false};
 
     void ChangeLevelRunning(Task* task, int level);
+    void AccountSwitch(Task* prev, Task* next);
+    Task* FindTask(uint64_t id);
+    void Handoff(Task* next, bool current_sleep);
 };
 
 inline TaskManager* task_manager = nullptr;
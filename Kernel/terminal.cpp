@@ -1,10 +1,14 @@
 #include <vector>
 #include <memory>
+#include <algorithm>
 
 #include "terminal.hpp"
 #include "window.hpp"
 #include "layer.hpp"
 #include "task.hpp"
+#include "timer.hpp"
+#include "interrupt.hpp"
+#include "benchmark.hpp"
 #include "font.hpp"
 #include "logger.hpp"
 #include "pci.hpp"
@@ -13,19 +17,42 @@
 #include "paging.hpp"
 #include "error.hpp"
 #include "asmfunc.h"
+#include "capture.hpp"
+#include "input_record.hpp"
 
 Message MakeLayerMessage(uint64_t task_id, unsigned int layer_id, LayerOperation op, Rectangle<int> area);
  
+namespace {
+  const Terminal::Cell kBlankCell{' ', 0};
+  // drawn_ にだけ入れる値。次の Render で必ず描き直させる
+  const Terminal::Cell kInvalidCell{0, 0xff};
+
+  bool SameCell(const Terminal::Cell& lhs, const Terminal::Cell& rhs) {
+    return lhs.c == rhs.c && lhs.attr == rhs.attr;
+  }
+
+  // 画面上のセル cell を描く位置
+  Vector2D<int> CellPos(Vector2D<int> cell) {
+    return {cell.x * 8 + 4, cell.y * 16 + 5};
+  }
+}
+
 Terminal::Terminal(uint64_t task_id): task_id_{task_id} {
   window_ = std::make_shared<ToplevelWindow>(
     kColumns * 8 + 8 + ToplevelWindow::kMarginX,
     kRows * 16 + 8 + ToplevelWindow::kMarginY,
-    screen_config.pixel_format,
+    window_pixel_format,
     "Terminal"
   );
 
   DrawTerminal(*window_->InnerWriter(), {0, 0}, window_->InnerSize());
 
+  lines_.resize(kScrollbackLines);
+  for(auto& line : lines_) {
+    line.fill(kBlankCell);
+  }
+  InvalidateDrawn();
+
   layer_id_ = layer_manager->NewLayer()
     .SetWindow(window_)
     .SetDraggable(true)
@@ -37,31 +64,161 @@ Terminal::Terminal(uint64_t task_id): task_id_{task_id} {
 }
 
 Rectangle<int> Terminal::BlinkCursor() {
+  if(top_mode_) {
+    DrawTop();
+    return {ToplevelWindow::kTopLeftMargin, window_->InnerSize()};
+  }
+
   cursor_visible_ = !cursor_visible_;
-  auto inner_area = DrawCursor(cursor_visible_); 
-  auto window_area = Rectangle<int>{inner_area.pos + ToplevelWindow::kTopLeftMargin, inner_area.size};
+  return Render();
+}
 
-  return window_area;
+std::array<Terminal::Cell, Terminal::kColumns>& Terminal::Line(uint64_t line) {
+  return lines_[line % kScrollbackLines];
 }
 
-Rectangle<int> Terminal::DrawCursor(bool visible) {
-  const auto color = visible ? ToColor(0xFFFFFF) : ToColor(0x000000);
-  const auto pos = CalcCursorPos();
-  const auto size = Vector2D<int>{7, 15};
+Terminal::Cell& Terminal::CellAt(Vector2D<int> pos) {
+  return Line(screen_top_ + pos.y)[pos.x];
+}
+
+void Terminal::ClearLine(uint64_t line) {
+  Line(line).fill(kBlankCell);
+}
+
+// 表示位置を lines 行ずらす。負なら古い行の方へ
+void Terminal::ScrollView(int lines) {
+  const uint64_t oldest = screen_top_ + kRows > kScrollbackLines ? screen_top_ + kRows - kScrollbackLines : 0;
+  const int64_t top = static_cast<int64_t>(view_top_) + lines;
+  view_top_ = std::clamp<int64_t>(top, oldest, screen_top_);
+}
 
-  FillRectangle(*window_->InnerWriter(), pos, size, color);
+void Terminal::InvalidateDrawn() {
+  for(auto& row : drawn_) {
+    row.fill(kInvalidCell);
+  }
+}
+
+// 属性の同じ n 個の並んだセルをまとめて描く
+void Terminal::DrawCells(Vector2D<int> pos, const Cell* cells, int n) {
+  auto& writer = *window_->InnerWriter();
+  const auto p = CellPos(pos);
+  if(cells[0].attr & kAttrReverse) {
+    for(int i = 0; i < n; ++i) {
+      const Vector2D<int> q{p.x + 8 * i, p.y};
+      FillRectangle(writer, q, {8, 16}, ToColor(0x000000));
+      FillRectangle(writer, q, {7, 15}, ToColor(0xFFFFFF));
+      WriteAscii(writer, q, cells[i].c, ToColor(0x000000));
+    }
+    return;
+  }
+
+  char s[kColumns + 1];
+  for(int i = 0; i < n; ++i) {
+    // NUL は文字列の終わりと区別できないので空白として描く
+    s[i] = cells[i].c != 0 ? cells[i].c : ' ';
+  }
+  s[n] = '\0';
+  WriteString(writer, p, s, ToColor(0xFFFFFF), ToColor(0x000000));
+}
+
+// 表示位置の変化はウィンドウ内の移動で済ませ、drawn_ と違うセルだけを描く。
+// 描き換えた範囲をウィンドウ座標で返す
+Rectangle<int> Terminal::Render() {
+  if(top_mode_) {
+    return {{0, 0}, {0, 0}};
+  }
+
+  Vector2D<int> dirty_begin{kColumns, kRows}, dirty_end{0, 0};
+  const int64_t delta = static_cast<int64_t>(view_top_ - drawn_top_);
+  if(delta != 0 && -kRows < delta && delta < kRows) {
+    const int n = delta > 0 ? delta : -delta;
+    const auto margin = ToplevelWindow::kTopLeftMargin;
+    const Vector2D<int> size{8 * kColumns, 16 * (kRows - n)};
+    if(delta > 0) {
+      window_->Move(margin + CellPos({0, 0}), {margin + CellPos({0, n}), size});
+      std::move(drawn_.begin() + n, drawn_.end(), drawn_.begin());
+      for(int y = kRows - n; y < kRows; ++y) {
+        drawn_[y].fill(kInvalidCell);
+      }
+      dirty_begin = {0, 0};
+      dirty_end = {kColumns, kRows - n};
+    } else {
+      window_->Move(margin + CellPos({0, n}), {margin + CellPos({0, 0}), size});
+      std::move_backward(drawn_.begin(), drawn_.end() - n, drawn_.end());
+      for(int y = 0; y < n; ++y) {
+        drawn_[y].fill(kInvalidCell);
+      }
+      dirty_begin = {0, n};
+      dirty_end = {kColumns, kRows};
+    }
+  } else if(delta != 0) {
+    InvalidateDrawn();
+  }
+  drawn_top_ = view_top_;
+
+  const uint64_t cursor_line = screen_top_ + cursor_.y;
+  std::array<Cell, kColumns> cells;
+  for(int y = 0; y < kRows; ++y) {
+    cells = Line(view_top_ + y);
+    if(cursor_visible_ && view_top_ + y == cursor_line) {
+      cells[cursor_.x].attr |= kAttrReverse;
+    }
+
+    // 描いてある内容と違うセルが続くところを、属性が変わるまでひと続きの文字列として描く
+    auto& drawn = drawn_[y];
+    int x = 0;
+    while(x < kColumns) {
+      if(SameCell(cells[x], drawn[x])) {
+        ++x;
+        continue;
+      }
+
+      int end = x + 1;
+      while(end < kColumns && !SameCell(cells[end], drawn[end]) && cells[end].attr == cells[x].attr) {
+        ++end;
+      }
+
+      DrawCells({x, y}, &cells[x], end - x);
+      std::copy(cells.begin() + x, cells.begin() + end, drawn.begin() + x);
+      dirty_begin = ElementMin(dirty_begin, {x, y});
+      dirty_end = ElementMax(dirty_end, {end, y + 1});
+      x = end;
+    }
+  }
 
-  return {pos, size};
+  if(dirty_end.x <= dirty_begin.x || dirty_end.y <= dirty_begin.y) {
+    return {{0, 0}, {0, 0}};
+  }
+  const auto pos = CellPos(dirty_begin);
+  return {ToplevelWindow::kTopLeftMargin + pos, CellPos(dirty_end) - pos};
 }
 
-Vector2D<int> Terminal::CalcCursorPos() const {
-  return Vector2D<int>{cursor_.x * 8 + 4, cursor_.y * 16 + 5};
+// 画面を lines 行上へ送る。流れた行はスクロールバックに残る
+void Terminal::ScrollLines(int lines) {
+  const bool following = view_top_ == screen_top_;
+  screen_top_ += lines;
+  for(int i = std::max(0, lines - kScrollbackLines); i < lines; ++i) {
+    ClearLine(screen_top_ + kRows - lines + i);
+  }
+
+  if(following) {
+    view_top_ = screen_top_;
+  } else {
+    ScrollView(0);
+  }
 }
 
 Rectangle<int> Terminal::InputKey(uint8_t modifier, uint8_t keycode, char ascii) {
-  DrawCursor(false);
-  
-  Rectangle<int> draw_area{ToplevelWindow::kTopLeftMargin + CalcCursorPos(), {8*2, 16}};
+  if(top_mode_) {
+    return ExitTop();
+  }
+
+  // PageUp と PageDown でスクロールバックを見る。ほかのキーを押すと入力位置へ戻る
+  if(keycode == 0x4b || keycode == 0x4e) {
+    ScrollView(keycode == 0x4b ? -kRows / 2 : kRows / 2);
+    return Render();
+  }
+  view_top_ = screen_top_;
 
   switch(ascii) {
     case '\n':
@@ -73,24 +230,18 @@ Rectangle<int> Terminal::InputKey(uint8_t modifier, uint8_t keycode, char ascii)
       }
       
       linebuf_index_ = 0;
-      cursor_.x = 0;
-      if(cursor_.y < kRows - 1) {
-        cursor_.y++;
-      } else {
-        Scroll_OneLine();
-      }
+      NewLines(1);
 
       ExecuteLine();
+      if(top_mode_) {
+        return {ToplevelWindow::kTopLeftMargin, window_->InnerSize()};
+      }
       Print("> ");
-
-      draw_area.pos = ToplevelWindow::kTopLeftMargin;
-      draw_area.size = window_->InnerSize();
       break;
     case '\b':
       if(cursor_.x > 0) {
         cursor_.x--;
-        FillRectangle(*window_->InnerWriter(), CalcCursorPos(), {8, 16}, ToColor(0x000000));
-        draw_area.pos = ToplevelWindow::kTopLeftMargin + CalcCursorPos();
+        CellAt(cursor_) = kBlankCell;
 
         if(linebuf_index_ > 0) {
           linebuf_index_--;
@@ -99,82 +250,74 @@ Rectangle<int> Terminal::InputKey(uint8_t modifier, uint8_t keycode, char ascii)
       break;
     default:
       if(keycode == 0x51) {
-        draw_area = HistoryUpDown(-1);
+        HistoryUpDown(-1);
       } else if (keycode == 0x52) {
-        draw_area = HistoryUpDown(1);
+        HistoryUpDown(1);
       } else if(ascii != 0 && cursor_.x < kColumns - 1 && linebuf_index_ < kLineMax - 1) {
         linebuf_[linebuf_index_] = ascii;
         linebuf_index_++;
-        WriteAscii(*window_->InnerWriter(), CalcCursorPos(), ascii, ToColor(0xFFFFFF));
+        CellAt(cursor_) = {ascii, 0};
         cursor_.x++;
       }
   }
 
-  DrawCursor(true);
-
-  return draw_area;
+  cursor_visible_ = true;
+  return Render();
 }
 
-void Terminal::Scroll_OneLine() {
-  Rectangle<int> move_src {
-    ToplevelWindow::kTopLeftMargin + Vector2D<int>{4, 4 + 16},
-    {8 * kColumns, 16 * (kRows - 1)}  
-  };
-
-  window_->Move(ToplevelWindow::kTopLeftMargin + Vector2D<int>{4, 4}, move_src);  
-  FillRectangle(*window_->InnerWriter(), {4, cursor_.y * 16 + 4}, {kColumns * 8, 16}, ToColor(0x000000));
+void Terminal::NewLines(int n) {
+  cursor_.x = 0;
+  const int down = std::min(n, kRows - 1 - cursor_.y);
+  cursor_.y += down;
+  if(n > down) {
+    ScrollLines(n - down);
+  }
 }
 
-void Terminal::Print(const char c) {
-  auto newline = [this]() {
-    cursor_.x = 0;
-    if(cursor_.y < kRows - 1) {
-      ++cursor_.y;
-    } else {
-      this->Scroll_OneLine();
+// セルだけを書き換え、描画はしない。改行までをひと区切りとして行の残りに収まる分ずつ写し、
+// 続く改行はまとめて送る
+void Terminal::Write(const char* s, size_t len) {
+  const char* const end = s + len;
+  while(s < end) {
+    if(*s == '\n') {
+      const char* p = s;
+      while(p < end && *p == '\n') {
+        ++p;
+      }
+      NewLines(static_cast<int>(p - s));
+      s = p;
+      continue;
     }
-  };
 
-  if(c == '\n') {
-    newline();
-  } else {
-    WriteAscii(*window_->InnerWriter(), CalcCursorPos(), c, ToColor(0xFFFFFF));
-    if(cursor_.x == kColumns - 1) {
-      newline();
-    } else {
-      cursor_.x++;
+    auto newline = static_cast<const char*>(memchr(s, '\n', end - s));
+    const char* const segment_end = newline ? newline : end;
+    while(s < segment_end) {
+      const int n = std::min<size_t>(segment_end - s, kColumns - cursor_.x);
+      auto cells = &Line(screen_top_ + cursor_.y)[cursor_.x];
+      for(int i = 0; i < n; ++i) {
+        cells[i] = {s[i], 0};
+      }
+      s += n;
+      cursor_.x += n;
+      if(cursor_.x == kColumns) {
+        NewLines(1);
+      }
     }
-  }  
+  }
+}
+
+void Terminal::Print(const char c) {
+  Write(&c, 1);
 }
 
 void Terminal::Print(const char* s, std::optional<size_t> len) {
-  const auto cursor_before = CalcCursorPos();
-  DrawCursor(false);
+  Write(s, len ? *len : strlen(s));
 
-  if(len) {
-    for(size_t i = 0; i < *len; i++) {
-      Print(*s);
-      s++;
-    } 
-  } else {
-    while(*s) {
-      Print(*s);
-      s++;
-    }
+  const auto draw_area = Render();
+  if(!IsEmpty(draw_area)) {
+    Message msg = MakeLayerMessage(task_id_, LayerID(), LayerOperation::DrawArea, draw_area);
+    task_manager->SendMessage(1, msg);
   }
-
-  DrawCursor(true);
-  const auto cursor_after = CalcCursorPos();
-
-  Vector2D<int> margin = ToplevelWindow::kTopLeftMargin;
-  Vector2D<int> draw_pos { margin.x, margin.y + cursor_before.y };
-  Vector2D<int> draw_size { window_->InnerSize().x, cursor_after.y - cursor_before.y + 16 };
-  Rectangle<int> draw_area { draw_pos, draw_size };
-  Message msg = MakeLayerMessage(task_id_, LayerID(), LayerOperation::DrawArea, draw_area);
-
-  __asm__("cli");
-  task_manager->SendMessage(1, msg);
-  __asm__("sti");
 }
 
 void Terminal::ExecuteLine() {
@@ -191,8 +334,111 @@ void Terminal::ExecuteLine() {
     }
     Print("\n");
   } else if(strcmp(command, "clear") == 0) {
-    FillRectangle(*window_->InnerWriter(), {0, 0}, window_->InnerSize(), ToColor(0x000000));
+    // 画面の内容は消さずにスクロールバックへ送る
+    screen_top_ += cursor_.y;
+    for(int y = 0; y < kRows; ++y) {
+      ClearLine(screen_top_ + y);
+    }
+    view_top_ = screen_top_;
     cursor_.y = 0;
+  } else if(strcmp(command, "top") == 0) {
+    top_mode_ = true;
+    top_prev_tsc_ = 0;
+    top_prev_runtime_.clear();
+    DrawTop();
+  } else if(strcmp(command, "irqoff") == 0) {
+    if(first_arg && strcmp(first_arg, "reset") == 0) {
+      InterruptGuard guard;
+      interrupt_off_tracker.Reset();
+    } else {
+      PrintInterruptOffStats();
+    }
+  } else if(strcmp(command, "ipcbench") == 0) {
+    BenchmarkIPC(first_arg ? atoi(first_arg) : 1000);
+  } else if(strcmp(command, "bench") == 0) {
+    char* bench_arg = nullptr;
+    if(first_arg) {
+      bench_arg = strchr(first_arg, ' ');
+      if(bench_arg) {
+        *bench_arg = 0;
+        bench_arg++;
+      }
+    }
+
+    if(!first_arg || !RunBenchmark(*this, first_arg, bench_arg)) {
+      Print("usage: bench <name> [count]\n");
+    }
+  } else if(strcmp(command, "capture") == 0) {
+    // capture [x y w h] で画面をシリアルポートへ送る。capture reset は合成の統計を消す
+    if(first_arg && strcmp(first_arg, "reset") == 0) {
+      layer_manager->ResetDrawStatistics();
+      return;
+    }
+
+    Rectangle<int> area{{0, 0}, ScreenSize()};
+    if(first_arg) {
+      int v[4];
+      char* p = first_arg;
+      int n = 0;
+      for(; n < 4; ++n) {
+        char* end;
+        v[n] = strtol(p, &end, 0);
+        if(end == p) {
+          break;
+        }
+        p = end;
+      }
+      if(n != 4) {
+        Print("usage: capture [x y w h | reset]\n");
+        return;
+      }
+      area = {{v[0], v[1]}, {v[2], v[3]}};
+    }
+
+    if(auto err = CaptureScreen(area)) {
+      char s[64];
+      sprintf(s, "capture failed: %s\n", err.Name());
+      Print(s);
+    }
+  } else if(strcmp(command, "input") == 0) {
+    // 入力の記録と再生。input save はシリアルポートへ、input load は FAT ボリュームから
+    char* input_arg = nullptr;
+    if(first_arg) {
+      input_arg = strchr(first_arg, ' ');
+      if(input_arg) {
+        *input_arg = 0;
+        input_arg++;
+      }
+    }
+
+    Error err = MAKE_ERROR(Error::kSuccess);
+    if(first_arg && strcmp(first_arg, "record") == 0) {
+      input_recorder->StartRecording();
+    } else if(first_arg && strcmp(first_arg, "stop") == 0) {
+      input_recorder->StopRecording();
+    } else if(first_arg && strcmp(first_arg, "replay") == 0) {
+      err = input_recorder->StartReplay(input_arg ? atoi(input_arg) : 1);
+    } else if(first_arg && strcmp(first_arg, "save") == 0) {
+      err = input_recorder->Save();
+    } else if(first_arg && strcmp(first_arg, "load") == 0 && input_arg) {
+      err = input_recorder->Load(input_arg);
+    } else if(first_arg && strcmp(first_arg, "status") == 0) {
+      char s[128];
+      sprintf(s, "%s, %lu events (%lu dropped), last replay %lu events in %lu us\n",
+          input_recorder->Recording() ? "recording" :
+          input_recorder->Replaying() ? "replaying" : "idle",
+          input_recorder->NumEvents(), input_recorder->DroppedEvents(),
+          input_recorder->ReplayedEvents(), input_recorder->ReplayElapsedMicroseconds());
+      Print(s);
+    } else {
+      Print("usage: input record | stop | replay [speed] | save | load <file> | status\n");
+    }
+
+    if(err) {
+      char s[64];
+      sprintf(s, "input failed: %s\n", err.Name());
+      Print(s);
+    }
   } else if(strcmp(command, "lspci") == 0) {
     char s[64];
     for (int i = 0; i < pci::num_device; i++) {
@@ -241,23 +487,13 @@ void Terminal::ExecuteLine() {
       auto cluster = file_entry->FirstCluster();
       auto remain_bytes = file_entry->file_size;
 
-      DrawCursor(false);
-      
       while(cluster != 0 && cluster != fat::kEndOfClusterChain) {
-        char* p = fat::GetSectorByCluster<char>(cluster);
-
-        int i = 0;
-        for(; i < fat::bytes_per_cluster && i < remain_bytes; i++) {
-          Print(*p);
-          p++;
-        }
+        const auto n = std::min<size_t>(fat::bytes_per_cluster, remain_bytes);
+        Write(fat::GetSectorByCluster<char>(cluster), n);
 
-        remain_bytes -= i;
+        remain_bytes -= n;
         cluster = fat::NextCluster(cluster);
       }
-      
-
-      DrawCursor(true);
     }
   } else if(command[0] != 0) {
     auto file_entry = fat::FindFile(command);
@@ -362,9 +598,7 @@ Error Terminal::ExecuteFile(const fat::DirectoryEntry& file_entry, char* command
     return err;
   }
 
-  __asm__("cli");
   auto& task = task_manager->CurrentTask();
-  __asm__("sti");
 
   auto entry_addr = elf_header->e_entry;
   CallApp(argc, argv, 3 << 3 | 3, entry_addr, stack_frame_addr.value + 4096 - 8, &task.OSStackPointer());
@@ -383,18 +617,15 @@ Error Terminal::ExecuteFile(const fat::DirectoryEntry& file_entry, char* command
   return MAKE_ERROR(Error::kSuccess);
 }
 
-Rectangle<int> Terminal::HistoryUpDown(int direction) {
+void Terminal::HistoryUpDown(int direction) {
   if(direction == -1 && cmd_history_index_ >= 0) {
     cmd_history_index_--;
   } else if(direction == 1 && cmd_history_index_ + 1 < cmd_history_.size()) {
     cmd_history_index_++;
   }
 
-  cursor_.x = 1;
-  const auto first_pos = CalcCursorPos();
-
-  Rectangle<int> draw_area{first_pos, {(kColumns - 1) * 8, 16}};
-  FillRectangle(*window_->InnerWriter(), draw_area.pos, draw_area.size, ToColor(0x000000));
+  auto& line = Line(screen_top_ + cursor_.y);
+  std::fill(line.begin() + 1, line.end(), kBlankCell);
 
   const char* history = "";
   if(cmd_history_index_ >= 0) {
@@ -404,12 +635,135 @@ Rectangle<int> Terminal::HistoryUpDown(int direction) {
   strcpy(&linebuf_[0], history);
   linebuf_index_ = strlen(history);
 
-  WriteString(*window_->InnerWriter(), first_pos, history, ToColor(0xFFFFFF));
+  for(int i = 0; i < linebuf_index_ && i + 1 < kColumns; ++i) {
+    line[i + 1] = {history[i], 0};
+  }
   cursor_.x = linebuf_index_ + 1;
+}
+
+// 前回の描画からのCPU使用率が高い順にタスクを表示する
+void Terminal::DrawTop() {
+  auto tasks = task_manager->Statistics();
+
+  const auto now = ReadTSC();
+  const auto elapsed = std::max<uint64_t>(now - top_prev_tsc_, 1);
+
+  struct Row {
+    TaskStatus status;
+    uint64_t recent;
+  };
+  std::vector<Row> rows;
+  for(const auto& task : tasks) {
+    rows.push_back({task, task.stats.runtime - top_prev_runtime_[task.id]});
+    top_prev_runtime_[task.id] = task.stats.runtime;
+  }
+  top_prev_tsc_ = now;
+
+  std::sort(rows.begin(), rows.end(), [](const Row& lhs, const Row& rhs) {
+    if(lhs.recent != rhs.recent) {
+      return lhs.recent > rhs.recent;
+    }
+    return lhs.status.stats.runtime > rhs.status.stats.runtime;
+  });
+
+  auto& writer = *window_->InnerWriter();
+  FillRectangle(writer, {0, 0}, window_->InnerSize(), ToColor(0x000000));
+
+  char s[kColumns + 1];
+  auto write_line = [&](int row, const char* line, uint32_t color) {
+    WriteString(writer, {4, row * 16 + 5}, line, ToColor(color));
+  };
 
-  draw_area.pos = draw_area.pos + ToplevelWindow::kTopLeftMargin;
+  write_line(0, "  ID LV ST  %CPU  TIME(ms) SWITCH WAKEUP    MSG WAIT(ms)", 0xC6C6C6);
+  const int max_rows = std::min<int>(rows.size(), kRows - 2);
+  for(int i = 0; i < max_rows; i++) {
+    const auto& status = rows[i].status;
+    const auto permille = rows[i].recent * 1000 / elapsed;
+    sprintf(s, "%4lu %2u %2s %3lu.%1lu %9lu %6lu %6lu %6lu %8lu",
+      status.id, status.level, status.running ? "R" : "S",
+      permille / 10, permille % 10,
+      TSCToMicroseconds(status.stats.runtime) / 1000,
+      status.stats.switches, status.stats.wakeups, status.stats.messages,
+      TSCToMicroseconds(status.stats.wait_time) / 1000
+    );
+    write_line(i + 1, s, 0xFFFFFF);
+  }
 
-  return draw_area; 
+  write_line(kRows - 1, "press any key to quit", 0xC6C6C6);
+}
+
+void Terminal::PrintInterruptOffStats() {
+  InterruptOffTracker tracker;
+  {
+    InterruptGuard guard;
+    tracker = interrupt_off_tracker;
+  }
+
+  char s[128];
+  const auto& max_site = tracker.MaxSite();
+  sprintf(s, "max %lu ns at %s:%d\n",
+    TSCToNanoseconds(tracker.Max()), max_site.file ? max_site.file : "-", max_site.line);
+  Print(s);
+
+  const auto& histogram = tracker.Histogram();
+  for(int i = 0; i < InterruptOffTracker::kBuckets; i++) {
+    if(histogram[i] == 0) {
+      continue;
+    }
+    sprintf(s, "  < %10lu ns: %lu\n", TSCToNanoseconds(1ul << i), histogram[i]);
+    Print(s);
+  }
+
+  for(const auto& site : tracker.Sites()) {
+    if(site.file == nullptr) {
+      continue;
+    }
+    sprintf(s, "  %s:%d count=%lu max=%lu ns\n",
+      site.file, site.line, site.count, TSCToNanoseconds(site.max));
+    Print(s);
+  }
+}
+
+// kLayer と kLayerFinish の往復時間を、メールボックス経由と Call による直接切り替えで比較する
+void Terminal::BenchmarkIPC(int count) {
+  if(count <= 0) {
+    return;
+  }
+
+  Task& task = task_manager->CurrentTask();
+  const Message msg = MakeLayerMessage(task_id_, LayerID(), LayerOperation::DrawArea, {{0, 0}, {0, 0}});
+
+  // 以前の描画要求に対する kLayerFinish を読み捨てておく
+  while(task.ReceiveMessage());
+
+  auto start = ReadTSC();
+  for(int i = 0; i < count; i++) {
+    task_manager->SendMessage(1, msg);
+    while(task.WaitMessage().type != Message::kLayerFinish);
+  }
+  const auto mailbox_tsc = ReadTSC() - start;
+
+  start = ReadTSC();
+  for(int i = 0; i < count; i++) {
+    task_manager->Call(1, msg);
+  }
+  const auto call_tsc = ReadTSC() - start;
+
+  char s[64];
+  sprintf(s, "mailbox: %lu ns/round trip\n", TSCToNanoseconds(mailbox_tsc / count));
+  Print(s);
+  sprintf(s, "call:    %lu ns/round trip\n", TSCToNanoseconds(call_tsc / count));
+  Print(s);
+}
+
+// top の前の画面を描き直して入力に戻る
+Rectangle<int> Terminal::ExitTop() {
+  top_mode_ = false;
+  DrawTerminal(*window_->InnerWriter(), {0, 0}, window_->InnerSize());
+  InvalidateDrawn();
+  Print("> ");
+
+  return {ToplevelWindow::kTopLeftMargin, window_->InnerSize()};
 }
 
 Message MakeLayerMessage(uint64_t task_id, unsigned int layer_id, LayerOperation op, Rectangle<int> area) {
@@ -425,59 +779,51 @@ Message MakeLayerMessage(uint64_t task_id, unsigned int layer_id, LayerOperation
 }
 
 void TaskTerminal(uint64_t task_id, int64_t data) {
-  __asm__("cli");
   Task& task = task_manager->CurrentTask();
   Terminal* terminal = new Terminal(task_id);
   layer_manager->Move(terminal->LayerID(), {100, 200});
   active_layer->Activate(terminal->LayerID());
-  layer_task_map->insert(std::make_pair(terminal->LayerID(), task_id));
-  (*terminals)[task_id] = terminal;
-  __asm__("sti");
+  {
+    MutexGuard lock{*layer_task_map_mutex};
+    layer_task_map->insert(std::make_pair(terminal->LayerID(), task_id));
+  }
+  {
+    MutexGuard lock{*terminals_mutex};
+    (*terminals)[task_id] = terminal;
+  }
 
   while(true) {
-    __asm__("cli");
-    auto msg = task.ReceiveMessage();
-    if(!msg) {
-      task.Sleep();
-      __asm__("sti");
-      continue;
-    }
-
-    __asm__("sti");
-    switch(msg->type) {
+    auto msg = task.WaitMessage();
+    switch(msg.type) {
       case Message::kTimerTimeout:
-        {
-          const auto area = terminal->BlinkCursor();
-          Message msg = MakeLayerMessage(
+        if(const auto area = terminal->BlinkCursor(); !IsEmpty(area)) {
+          Message layer_msg = MakeLayerMessage(
             task_id, 
             terminal->LayerID(), 
             LayerOperation::DrawArea,
             area
           );
-
-          __asm__("cli");
-          task_manager->SendMessage(1, msg);
-          __asm__("sti");
+          task_manager->SendMessage(1, layer_msg);
         }
         break;
       case Message::kKeyPush:
         {
           const auto area = terminal->InputKey(
-            msg->arg.keyboard.modifier,
-            msg->arg.keyboard.keycode,
-            msg->arg.keyboard.ascii
+            msg.arg.keyboard.modifier,
+            msg.arg.keyboard.keycode,
+            msg.arg.keyboard.ascii
           );
+          if(IsEmpty(area)) {
+            break;
+          }
 
-          Message msg = MakeLayerMessage(
+          Message layer_msg = MakeLayerMessage(
             task_id,
             terminal->LayerID(),
             LayerOperation::DrawArea,
             area
           );
-
-          __asm__("cli");
-          task_manager->SendMessage(1, msg);
-          __asm__("sti");
+          task_manager->SendMessage(1, layer_msg);
         }
         break;
       default:
@@ -5,17 +5,28 @@
 #include <array>
 #include <deque>
 #include <map>
+#include <vector>
 
 #include "window.hpp"
 #include "graphics.hpp"
 #include "fat.hpp"
 #include "error.hpp"
+#include "sync.hpp"
 
 class Terminal {
   public:
     static const int kRows = 15;
     static const int kColumns = 60;
     static const int kLineMax = 128;
+    // 画面から流れた行をこの行数まで覚えておく（画面の行を含む）
+    static const int kScrollbackLines = 512;
+
+    // 文字セル。attr は kAttr* の組み合わせ
+    struct Cell {
+      char c;
+      uint8_t attr;
+    };
+    static const uint8_t kAttrReverse = 0x01;
 
     Terminal(uint64_t task_id);
     unsigned int LayerID() const { return layer_id_; }
@@ -30,22 +41,50 @@ class Terminal {
     uint64_t task_id_;
     unsigned int layer_id_;
     
+    // 行は書き始めからの通し番号で表し、lines_[番号 % kScrollbackLines] に置く。
+    // screen_top_ はカーソルのある画面の先頭行、view_top_ は表示している先頭行で、
+    // スクロールバックを見ているあいだは screen_top_ より小さい
+    std::vector<std::array<Cell, kColumns>> lines_;
+    uint64_t screen_top_{0};
+    uint64_t view_top_{0};
+    std::array<Cell, kColumns>& Line(uint64_t line);
+    Cell& CellAt(Vector2D<int> pos);
+    void ClearLine(uint64_t line);
+    void ScrollView(int lines);
+
+    // ウィンドウに描いてあるセル。Render はこれと違うセルだけを描く
+    std::array<std::array<Cell, kColumns>, kRows> drawn_;
+    uint64_t drawn_top_{0};
+    void InvalidateDrawn();
+    Rectangle<int> Render();
+    void DrawCells(Vector2D<int> pos, const Cell* cells, int n);
+
     Vector2D<int> cursor_{0, 0};
     bool cursor_visible_{false};
-    Rectangle<int> DrawCursor(bool visible);
-    Vector2D<int> CalcCursorPos() const;
 
     int linebuf_index_{0};
     std::array<char, kLineMax> linebuf_{};
-    void Scroll_OneLine();
+    void ScrollLines(int lines);
+    void NewLines(int n);
+    void Write(const char* s, size_t len);
 
     std::deque<std::array<char, kLineMax>> cmd_history_{};
     int cmd_history_index_{-1};
-    Rectangle<int> HistoryUpDown(int direction);
+    void HistoryUpDown(int direction);
 
     Error ExecuteFile(const fat::DirectoryEntry& file_entry, char* command, char* first_arg);
+
+    bool top_mode_{false};
+    uint64_t top_prev_tsc_{0};
+    std::map<uint64_t, uint64_t> top_prev_runtime_{};
+    void DrawTop();
+    Rectangle<int> ExitTop();
+
+    void PrintInterruptOffStats();
+    void BenchmarkIPC(int count);
 };
 
 inline std::map<uint64_t, Terminal*>* terminals;
+inline Mutex* terminals_mutex;
 
 void TaskTerminal(uint64_t task_id, int64_t data);
\ No newline at end of file
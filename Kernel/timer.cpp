@@ -7,6 +7,7 @@
 #include "message.hpp"
 #include "logger.hpp"
 #include "task.hpp"
+#include "asmfunc.h"
 
 namespace {
   const uint32_t kCountMax = 0xFFFFFFFFu;
@@ -53,6 +54,8 @@ bool TimerManager::Tick() {
 }
 
 void TimerManager::AddTimer(const Timer& timer) {
+  // タイマ割り込みからも参照されるため割り込み禁止で操作する
+  InterruptGuard guard;
   timers_.push(timer);
 }
 
@@ -62,12 +65,15 @@ void InitializeAPICTimer() {
   divide_config = 0b1011;
   lvt_timer = (0b010 << 16) | InterruptVector::kLAPICTimer;    
 
+  const auto tsc_start = ReadTSC();
   StartAPICTimer();
   acpi::WaitMilliseconds(1000);
   const auto elapsed = LAPICTimerElapsed();
   StopLAPICTimer();
+  const auto tsc_end = ReadTSC();
 
   lapic_timer_freq = static_cast<unsigned long>(elapsed);
+  tsc_freq = tsc_end - tsc_start;
 
   divide_config = 0b1011;
   lvt_timer = (0b010 << 16) | InterruptVector::kLAPICTimer;
@@ -32,11 +32,22 @@ class TimerManager {
 
 inline TimerManager* timer_manager;
 inline unsigned long lapic_timer_freq = 0;
+inline uint64_t tsc_freq = 0;
 const int kTimerFreq = 100;
 
 const int kTaskTimerPeriod = static_cast<int>(kTimerFreq * 0.02);
 const int kTaskTimerValue = std::numeric_limits<int>::min();
 
+inline uint64_t TSCToMicroseconds(uint64_t tsc) {
+  const uint64_t tsc_per_us = tsc_freq / 1000000;
+  return tsc_per_us == 0 ? 0 : tsc / tsc_per_us;
+}
+
+inline uint64_t TSCToNanoseconds(uint64_t tsc) {
+  const uint64_t tsc_per_us = tsc_freq / 1000000;
+  return tsc_per_us == 0 ? 0 : tsc * 1000 / tsc_per_us;
+}
+
 void InitializeAPICTimer();
 void StartAPICTimer();
 uint32_t LAPICTimerElapsed();
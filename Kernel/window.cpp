@@ -24,21 +24,15 @@ const char close_button[kCloseButtonHeight][kCloseButtonWidth + 1] = {
     "@@@@@@@@@@@@@@@@",
 };
 
-Window::Window(int width, int height, PixelFormat shadow_format) : width_{width}, height_{height}
+Window::Window(int width, int height, PixelFormat shadow_format, size_t buffer_alignment) : width_{width}, height_{height}
 {
-  data_.resize(height);
-  for (int y = 0; y < height; y++)
-  {
-    data_[y].resize(width);
-  }
-
   FrameBufferConfig config{};
   config.frame_buffer = nullptr;
   config.horizontal_resolution = width;
   config.vertical_resolution = height;
   config.pixel_format = shadow_format;
 
-  if (auto err = shadow_buffer_.Initialize(config))
+  if (auto err = shadow_buffer_.Initialize(config, buffer_alignment))
   {
     Log(kError, "failed to initialize shadow buffer: %s at %s:%d\n", err.Name(), err.File(), err.Line());
   }
@@ -46,6 +40,12 @@ Window::Window(int width, int height, PixelFormat shadow_format) : width_{width}
 
 void Window::DrawTo(FrameBuffer &dst, Vector2D<int> pos, const Rectangle<int> &area)
 {
+  if (alpha_blending_)
+  {
+    DrawBlended(dst, pos, area);
+    return;
+  }
+
   if (!transparent_color_)
   {
     Rectangle<int> window_area{pos, Size()};
@@ -57,41 +57,174 @@ void Window::DrawTo(FrameBuffer &dst, Vector2D<int> pos, const Rectangle<int> &a
     return;
   }
 
-  const auto tc = transparent_color_.value();
   auto &writer = dst.Writer();
-  auto height_init = pos.y < 0 ? -pos.y : 0;
-  auto height_end = pos.y + Height() > writer.Height() ? writer.Height() - pos.y : Height();
-  auto width_init = pos.x < 0 ? -pos.x : 0;
-  auto width_end = pos.x + Width() > writer.Width() ? writer.Width() - pos.x : Width();
-  for (
-      int y = height_init; y < height_end; y++)
-  {
-    for (int x = width_init; x < width_end; x++)
+  const Rectangle<int> screen_area{{0, 0}, {writer.Width(), writer.Height()}};
+  const auto draw_area = area & screen_area & Rectangle<int>{pos, Size()};
+  if (IsEmpty(draw_area))
+  {
+    return;
+  }
+
+  const auto start = draw_area.pos - pos;
+  const auto format = shadow_buffer_.Config().pixel_format;
+  if (dst.Config().pixel_format != format)
+  {
+    for (int y = start.y; y < start.y + draw_area.size.y; y++)
     {
-      const auto c = At(x, y);
+      for (int x = start.x; x < start.x + draw_area.size.x; x++)
+      {
+        const auto c = At({x, y});
+        if (c != transparent_color_.value())
+        {
+          writer.Write(pos + Vector2D<int>{x, y}, c);
+        }
+      }
+    }
+    return;
+  }
 
-      if (tc != c)
+  // 同じピクセル形式どうしなので、あらかじめ求めた不透明な範囲だけをそのまま転送する
+  UpdateOpaqueSpans();
+  const int end_x = start.x + draw_area.size.x;
+  for (int dy = 0; dy < draw_area.size.y; dy++)
+  {
+    const int y = start.y + dy;
+    const auto src = reinterpret_cast<const uint32_t *>(shadow_buffer_.PixelAt({0, y}));
+    auto dst_row = reinterpret_cast<uint32_t *>(dst.PixelAt({pos.x, pos.y + y}));
+    for (const auto &span : opaque_spans_[y])
+    {
+      const int x0 = std::max(span.x, start.x);
+      const int x1 = std::min(span.x + span.length, end_x);
+      if (x0 < x1)
       {
-        writer.Write(pos + Vector2D<int>{x, y}, c);
+        CopyPixels32(dst_row + x0, src + x0, x1 - x0);
       }
     }
   }
 }
 
+// 不透明だと分かっている範囲はそのまま転送し、残りだけを下の画素と合成する
+void Window::DrawBlended(FrameBuffer &dst, Vector2D<int> pos, const Rectangle<int> &area)
+{
+  const Rectangle<int> dst_area{{0, 0}, {dst.Writer().Width(), dst.Writer().Height()}};
+  const auto draw_area = area & dst_area & Rectangle<int>{pos, Size()};
+  if (IsEmpty(draw_area) || dst.Config().pixel_format != shadow_buffer_.Config().pixel_format)
+  {
+    return;
+  }
+
+  const Rectangle<int> hint{opaque_hint_.pos + pos, opaque_hint_.size};
+  const auto copy_area = draw_area & hint;
+  if (!IsEmpty(copy_area))
+  {
+    dst.Copy(copy_area.pos, shadow_buffer_, {copy_area.pos - pos, copy_area.size});
+  }
+
+  Rectangle<int> blend_areas[4];
+  const auto blend_end = SubtractRectangle(draw_area, hint, blend_areas);
+  for (auto it = blend_areas; it != blend_end; ++it)
+  {
+    for (int dy = 0; dy < it->size.y; dy++)
+    {
+      const auto p = it->pos + Vector2D<int>{0, dy};
+      BlendPixels32(reinterpret_cast<uint32_t *>(dst.PixelAt(p)),
+                    reinterpret_cast<const uint32_t *>(shadow_buffer_.PixelAt(p - pos)),
+                    it->size.x);
+    }
+  }
+}
+
+Rectangle<int> Window::OpaqueArea() const
+{
+  if (alpha_blending_)
+  {
+    return opaque_hint_ & Rectangle<int>{{0, 0}, Size()};
+  }
+  if (transparent_color_)
+  {
+    return {{0, 0}, {0, 0}};
+  }
+  return {{0, 0}, Size()};
+}
+
+void Window::MarkDirty(int y, int height)
+{
+  if (!transparent_color_ || height <= 0)
+  {
+    return;
+  }
+
+  const int begin = std::max(y, 0);
+  const int end = std::min(y + height, height_);
+  if (begin >= end)
+  {
+    return;
+  }
+
+  if (dirty_begin_ == dirty_end_)
+  {
+    dirty_begin_ = begin;
+    dirty_end_ = end;
+  }
+  else
+  {
+    dirty_begin_ = std::min(dirty_begin_, begin);
+    dirty_end_ = std::max(dirty_end_, end);
+  }
+}
+
+void Window::UpdateOpaqueSpans()
+{
+  opaque_spans_.resize(height_);
+  const auto tc = transparent_pixel_;
+  for (int y = dirty_begin_; y < dirty_end_; y++)
+  {
+    auto &spans = opaque_spans_[y];
+    spans.clear();
+
+    const auto row = reinterpret_cast<const uint32_t *>(shadow_buffer_.PixelAt({0, y}));
+    int x = 0;
+    while (x < width_)
+    {
+      while (x < width_ && (row[x] & kPixelColorMask) == tc)
+      {
+        x++;
+      }
+      const int begin = x;
+      while (x < width_ && (row[x] & kPixelColorMask) != tc)
+      {
+        x++;
+      }
+      if (begin < x)
+      {
+        spans.push_back({begin, x - begin});
+      }
+    }
+  }
+
+  dirty_begin_ = dirty_end_ = 0;
+}
+
 void Window::Write(Vector2D<int> pos, PixelColor c)
 {
-  data_[pos.y][pos.x] = c;
+  MarkDirty(pos.y, 1);
   shadow_buffer_.Writer().Write(pos, c);
 }
 
 void Window::SetTransparentColor(std::optional<PixelColor> c)
 {
   transparent_color_ = c;
+  if (c)
+  {
+    transparent_pixel_ = EncodePixel(shadow_buffer_.Config().pixel_format, *c);
+    MarkDirty(0, height_);
+  }
 }
 
 void Window::Move(Vector2D<int> dst_pos, const Rectangle<int> &src)
 {
   shadow_buffer_.Move(dst_pos, src);
+  MarkDirty(dst_pos.y, src.size.y);
 }
 
 Window::WindowWriter *Window::Writer()
@@ -99,14 +232,10 @@ Window::WindowWriter *Window::Writer()
   return &writer_;
 }
 
-PixelColor &Window::At(int x, int y)
-{
-  return data_[y][x];
-}
-
-const PixelColor &Window::At(int x, int y) const
+PixelColor Window::At(Vector2D<int> pos) const
 {
-  return data_[y][x];
+  const auto format = shadow_buffer_.Config().pixel_format;
+  return DecodePixel(format, *reinterpret_cast<const uint32_t *>(shadow_buffer_.PixelAt(pos)));
 }
 
 int Window::Width() const
@@ -126,7 +255,7 @@ Vector2D<int> Window::Size() const
       height_};
 }
 
-ToplevelWindow::ToplevelWindow(int width, int height, PixelFormat shadow_format, const std::string &title) : Window{width, height, shadow_format}, title_{title}
+ToplevelWindow::ToplevelWindow(int width, int height, PixelFormat shadow_format, const std::string &title, size_t buffer_alignment) : Window{width, height, shadow_format, buffer_alignment}, title_{title}
 {
   DrawWindow(*Writer(), title_.c_str());
 }
@@ -18,23 +18,59 @@ class Window {
         virtual int Width() const override { return window_.Width(); }
         virtual int Height() const override { return window_.Height(); }
 
+        // バッファの書き込み器へそのまま渡す
+        virtual void FillSpan(Vector2D<int> pos, int length, const PixelColor& c) override {
+          window_.MarkDirty(pos.y, 1);
+          window_.shadow_buffer_.Writer().FillSpan(pos, length, c);
+        }
+        virtual void FillRect(const Rectangle<int>& rect, const PixelColor& c) override {
+          window_.MarkDirty(rect.pos.y, rect.size.y);
+          window_.shadow_buffer_.Writer().FillRect(rect, c);
+        }
+        virtual void BlitRect(Vector2D<int> pos, const PixelColor* src, Vector2D<int> size, int src_stride) override {
+          window_.MarkDirty(pos.y, size.y);
+          window_.shadow_buffer_.Writer().BlitRect(pos, src, size, src_stride);
+        }
+        virtual void MaskedFill(Vector2D<int> pos, const uint8_t* mask, Vector2D<int> size, const PixelColor& c) override {
+          window_.MarkDirty(pos.y, size.y);
+          window_.shadow_buffer_.Writer().MaskedFill(pos, mask, size, c);
+        }
+        // 書き込まれる範囲が分からないので、pos より下の行はすべて変わったものとする
+        virtual uint32_t* NativePixelAt(Vector2D<int> pos, PixelFormat& format, int& stride) override {
+          window_.MarkDirty(pos.y, window_.Height() - pos.y);
+          return window_.shadow_buffer_.Writer().NativePixelAt(pos, format, stride);
+        }
+
       private:
         Window& window_;
     };
 
-    Window(int width, int height, PixelFormat shadow_format);
+    // buffer_alignment はバッファの先頭と大きさを揃える境界。アプリへ共有するならページ境界にする
+    Window(int width, int height, PixelFormat shadow_format,
+           size_t buffer_alignment = FrameBuffer::kScanlineAlignment);
     virtual ~Window() = default;
     Window(const Window& rhs) = delete;
     Window& operator=(const Window& rhs) = delete;
 
     void DrawTo(FrameBuffer& dst, Vector2D<int> position, const Rectangle<int>& area);    
     void SetTransparentColor(std::optional<PixelColor> c);
+    // 画素ごとの不透明度 (PixelColor::a) を使って下のレイヤに重ねる
+    void SetAlphaBlending(bool enable) { alpha_blending_ = enable; }
+    // アルファ合成するとき、必ず不透明だと分かっている範囲（ウィンドウ内の座標）。合成せずにそのまま転送する
+    void SetOpaqueHint(const Rectangle<int>& area) { opaque_hint_ = area; }
+    bool IsOpaque() const { return !transparent_color_ && !alpha_blending_; }
+    // 下のレイヤを完全に覆う範囲（ウィンドウ内の座標）
+    Rectangle<int> OpaqueArea() const;
     void Move(Vector2D<int> dst_pos, const Rectangle<int>& src);
     WindowWriter* Writer();    
 
-    PixelColor& At(int x, int y);
-    const PixelColor& At(int x, int y) const;
+    PixelColor At(Vector2D<int> pos) const;
     void Write(Vector2D<int> pos, PixelColor c);
+    // ウィンドウの画素を保持するバッファのバイト数
+    size_t BufferBytes() const { return shadow_buffer_.BufferBytes(); }
+    // 画素を保持するバッファ。書き込み器を通さずに書き換えたら MarkDirty で行を知らせる
+    FrameBuffer& Buffer() { return shadow_buffer_; }
+    void MarkDirty(int y, int height);
 
     int Width() const;
     int Height() const;
@@ -44,12 +80,28 @@ class Window {
     virtual void Deactivate() {}
 
   private:
+    // 透過色でない画素が続く範囲
+    struct Span {
+      int x, length;
+    };
+
+    void DrawBlended(FrameBuffer& dst, Vector2D<int> pos, const Rectangle<int>& area);
+    void UpdateOpaqueSpans();
+
     int width_;
     int height_;
-    std::vector<std::vector<PixelColor>> data_{};
     WindowWriter writer_{*this};
     std::optional<PixelColor> transparent_color_{std::nullopt};
-
+    // transparent_color_ をバッファ上の表現に変換したもの
+    uint32_t transparent_pixel_{0};
+    bool alpha_blending_{false};
+    Rectangle<int> opaque_hint_{{0, 0}, {0, 0}};
+    // 透過色を持つとき、行ごとの不透明な範囲。内容が変わった行 [dirty_begin_, dirty_end_) は描画前に作り直す
+    std::vector<std::vector<Span>> opaque_spans_{};
+    int dirty_begin_{0};
+    int dirty_end_{0};
+
+    // 画面と同じピクセル形式で画素を保持する唯一のバッファ
     FrameBuffer shadow_buffer_{};
 };
 
@@ -73,11 +125,28 @@ class ToplevelWindow : public Window {
           return window_.Height() - kTopLeftMargin.y - kBottomRightMargin.y;
         }
 
+        virtual void FillSpan(Vector2D<int> pos, int length, const PixelColor& c) override {
+          window_.Writer()->FillSpan(pos + kTopLeftMargin, length, c);
+        }
+        virtual void FillRect(const Rectangle<int>& rect, const PixelColor& c) override {
+          window_.Writer()->FillRect({rect.pos + kTopLeftMargin, rect.size}, c);
+        }
+        virtual void BlitRect(Vector2D<int> pos, const PixelColor* src, Vector2D<int> size, int src_stride) override {
+          window_.Writer()->BlitRect(pos + kTopLeftMargin, src, size, src_stride);
+        }
+        virtual void MaskedFill(Vector2D<int> pos, const uint8_t* mask, Vector2D<int> size, const PixelColor& c) override {
+          window_.Writer()->MaskedFill(pos + kTopLeftMargin, mask, size, c);
+        }
+        virtual uint32_t* NativePixelAt(Vector2D<int> pos, PixelFormat& format, int& stride) override {
+          return window_.Writer()->NativePixelAt(pos + kTopLeftMargin, format, stride);
+        }
+
         private:
           ToplevelWindow& window_;
     };
 
-    ToplevelWindow(int widht, int height, PixelFormat shadow_format, const std::string& title);
+    ToplevelWindow(int widht, int height, PixelFormat shadow_format, const std::string& title,
+                   size_t buffer_alignment = FrameBuffer::kScanlineAlignment);
 
     virtual void Activate() override;
     virtual void Deactivate() override;
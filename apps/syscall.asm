@@ -34,4 +34,25 @@ SyscallWinWriteString:
   mov eax, 0x80000004
   mov r10, rcx
   syscall
+  ret
+
+global SyscallOpenWindowSurface
+SyscallOpenWindowSurface:
+  mov eax, 0x80000005
+  mov r10, rcx
+  syscall
+  ret
+
+global SyscallWinPresent
+SyscallWinPresent:
+  mov eax, 0x80000006
+  mov r10, rcx
+  syscall
+  ret
+
+global SyscallWinDraw
+SyscallWinDraw:
+  mov eax, 0x80000007
+  mov r10, rcx
+  syscall
   ret
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include "logger.hpp"
 
@@ -14,4 +15,70 @@ extern "C" {
   void SyscallExit(int code);
   struct SyscallResult SyscallOpenWindow(int w, int h, int x, int y, const char* title);
   struct SyscallResult SyscallWinWriteString(unsigned int layer_id, int x, int y, uint32_t color, const char* msg);
+
+  // ウィンドウの内側の画素。pixel_format が 0 なら 0x00BBGGRR、1 なら 0x00RRGGBB で書く（上位 8 ビットは 0）
+  struct WindowSurface {
+    uint32_t* pixels;
+    int width, height;
+    int pixels_per_scanline;
+    int pixel_format;
+  };
+
+  struct SurfaceRect {
+    int x, y, width, height;
+  };
+
+  // 内側の大きさが w x h のウィンドウを開き、その画素を surface に割り当てる
+  struct SyscallResult SyscallOpenWindowSurface(int w, int h, int x, int y, const char* title, struct WindowSurface* surface);
+  // 書き換えた範囲を画面に反映する。num_rects が 0 なら内側全体
+  struct SyscallResult SyscallWinPresent(unsigned int layer_id, const struct SurfaceRect* rects, size_t num_rects);
+
+  // SyscallWinDraw に渡す描画命令。各命令は DrawCommandHeader で始まり、
+  // size は見出しを含むバイト数（4 の倍数）。命令はバッファに隙間なく並べる
+  enum DrawCommandType {
+    kDrawFillRect = 1,
+    kDrawLine = 2,
+    kDrawText = 3,
+    kDrawBlit = 4,
+  };
+
+  struct DrawCommandHeader {
+    uint16_t type;
+    uint16_t size;
+  };
+
+  struct DrawFillRect {
+    struct DrawCommandHeader header;
+    int x, y, width, height;
+    uint32_t color;
+  };
+
+  struct DrawLineCommand {
+    struct DrawCommandHeader header;
+    int x0, y0, x1, y1;
+    uint32_t color;
+  };
+
+  // text には length バイトの文字が続く。flags の bit 0 を立てると bg で背景も塗る
+  struct DrawText {
+    struct DrawCommandHeader header;
+    int x, y;
+    uint32_t color, bg;
+    uint32_t flags;
+    uint32_t length;
+    char text[];
+  };
+
+  // pixels は r, g, b, a の順に 4 バイトずつ並ぶ画素で、1行は stride 画素
+  struct DrawBlit {
+    struct DrawCommandHeader header;
+    int x, y, width, height;
+    int stride;
+    uint32_t reserved;
+    const void* pixels;
+  };
+
+  // buf の命令をまとめてウィンドウに描き、描いた範囲を1度に画面へ反映する。
+  // 不正な命令があれば何も描かずに EINVAL を返す。value は検査を通った命令の数
+  struct SyscallResult SyscallWinDraw(unsigned int layer_id, const void* buf, size_t bytes);
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+#include "../syscall.h"
+
+namespace {
+  uint32_t Encode(const WindowSurface& surface, uint8_t r, uint8_t g, uint8_t b) {
+    if(surface.pixel_format == 0) {
+      return static_cast<uint32_t>(b) << 16 | static_cast<uint32_t>(g) << 8 | r;
+    }
+    return static_cast<uint32_t>(r) << 16 | static_cast<uint32_t>(g) << 8 | b;
+  }
+}
+
+extern "C" void main(int argc, char** argv) {
+  WindowSurface surface;
+  auto [layer_id, err] = SyscallOpenWindowSurface(256, 128, 10, 10, "winsurface", &surface);
+  if(err) {
+    SyscallExit(err);
+  }
+
+  for(int y = 0; y < surface.height; ++y) {
+    uint32_t* line = surface.pixels + y * surface.pixels_per_scanline;
+    for(int x = 0; x < surface.width; ++x) {
+      line[x] = Encode(surface, x, y * 2, 255 - x);
+    }
+  }
+  SyscallWinPresent(layer_id, nullptr, 0);
+
+  // 一部だけ描き直して、その範囲だけを反映する
+  SurfaceRect rect{16, 16, 64, 32};
+  for(int y = rect.y; y < rect.y + rect.height; ++y) {
+    uint32_t* line = surface.pixels + y * surface.pixels_per_scanline;
+    for(int x = rect.x; x < rect.x + rect.width; ++x) {
+      line[x] = Encode(surface, 255, 255, 255);
+    }
+  }
+  SyscallWinPresent(layer_id, &rect, 1);
+
+  SyscallExit(0);
+}
\ No newline at end of file
@@ -0,0 +1,338 @@
+#!/usr/bin/python3
+"""QEMU で画面を出さずに OS を起動し、スクリプトどおりに入力して画面を取り込み、正解画像と比べる。
+
+カーネルの capture コマンドは合成済みの画面を PPM にしてシリアルポート (COM1) へ送る。
+このスクリプトは QEMU のモニタからキー入力・マウス操作を送り、シリアルの出力から取り込んだ画像と
+合成の計測値 (LayerManager::Compose の回数と時間) を取り出す。
+
+スクリプトの書式（1行1命令、# 以降はコメント）:
+  wait SECONDS            待つ
+  type TEXT               文字列を打つ
+  key KEY...              QEMU の sendkey のキー名で打つ（例: ret, ctrl-c）
+  mouse DX DY             マウスを動かす
+  click                   左ボタンを押して離す
+  reset                   合成の統計を消す (capture reset)
+  capture NAME [X Y W H]  画面を取り込み、正解画像 NAME.ppm と比べる。
+                          正解画像が無ければ警告を出して比べない。--update で取り込みを正解画像にする
+  record                  入力の記録を始める (input record)
+  stop                    入力の記録を止める (input stop)
+  save NAME               記録した入力を出力先の NAME.inp に保存する (input save)
+  load FILE               ディスクに置いた記録ファイルを読み込む (input load、--file で置く)
+  replay NAME [SPEED]     記録した入力を SPEED 倍速で再生し、終わるまで待つ (input replay)。
+                          SPEED が 0 なら待たずに流し込む。所要時間を計測値 NAME として残す
+
+記録した入力をそのまま再生すれば、ドラッグや入力の多い操作を何度でも同じように計測できる。
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+
+CAPTURE_HEADER = re.compile(
+    rb'@@CAPTURE (-?\d+) (-?\d+) (\d+) (\d+) frames=(\d+) avg_us=(\d+) max_us=(\d+)\n')
+CAPTURE_END = b'\n@@END\n'
+INPUT_HEADER = re.compile(rb'@@INPUT bytes=(\d+)\n')
+REPLAY_LINE = re.compile(rb'@@REPLAY events=(\d+) elapsed_us=(\d+)\n')
+
+KEY_NAMES = {
+    ' ': 'spc', '-': 'minus', '=': 'equal', '.': 'dot', ',': 'comma', '/': 'slash',
+    ';': 'semicolon', '\'': 'apostrophe', '[': 'bracket_left', ']': 'bracket_right',
+    '\\': 'backslash', '\n': 'ret', '\t': 'tab',
+    '_': 'shift-minus', '+': 'shift-equal', ':': 'shift-semicolon', '"': 'shift-apostrophe',
+    '>': 'shift-dot', '<': 'shift-comma', '?': 'shift-slash', '!': 'shift-1', '*': 'shift-8',
+}
+
+
+def key_name(c: str) -> str:
+    if c in KEY_NAMES:
+        return KEY_NAMES[c]
+    if c.isupper():
+        return 'shift-' + c.lower()
+    if c.isalnum():
+        return c
+    raise ValueError('cannot type {!r}'.format(c))
+
+
+def read_ppm(data: bytes) -> tuple:
+    """P6 形式の画像を (幅, 高さ, 画素のバイト列) にする"""
+    m = re.match(rb'P6\s+(\d+)\s+(\d+)\s+255\s', data)
+    if not m:
+        raise ValueError('not a binary PPM')
+    w, h = int(m.group(1)), int(m.group(2))
+    pixels = data[m.end():m.end() + 3 * w * h]
+    if len(pixels) != 3 * w * h:
+        raise ValueError('truncated PPM')
+    return w, h, pixels
+
+
+def write_ppm(path: str, w: int, h: int, pixels: bytes):
+    with open(path, 'wb') as f:
+        f.write('P6\n{} {}\n255\n'.format(w, h).encode())
+        f.write(pixels)
+
+
+def compare(actual: tuple, expected: tuple) -> tuple:
+    """違う画素の数と、違う画素を赤く塗った差分画像を返す"""
+    if actual[:2] != expected[:2]:
+        return actual[0] * actual[1], None
+    a, e = actual[2], expected[2]
+    diff = bytearray(len(a))
+    count = 0
+    for i in range(0, len(a), 3):
+        if a[i:i + 3] != e[i:i + 3]:
+            count += 1
+            diff[i] = 255
+        else:
+            # 同じところは薄く残す
+            diff[i:i + 3] = bytes(v // 4 for v in a[i:i + 3])
+    return count, bytes(diff)
+
+
+def make_image(path: str, loader: str, kernel: str, files: list):
+    subprocess.run(['qemu-img', 'create', '-f', 'raw', path, '200M'], check=True, stdout=subprocess.DEVNULL)
+    subprocess.run(['mkfs.fat', '-n', 'MIKAN OS', '-s', '2', '-f', '2', '-R', '32', '-F', '32', path],
+                   check=True, stdout=subprocess.DEVNULL)
+    subprocess.run(['mmd', '-i', path, '::/EFI', '::/EFI/BOOT'], check=True)
+    subprocess.run(['mcopy', '-i', path, loader, '::/EFI/BOOT/BOOTX64.EFI'], check=True)
+    subprocess.run(['mcopy', '-i', path, kernel, '::/kernel.elf'], check=True)
+    for f in files:
+        subprocess.run(['mcopy', '-i', path, f, '::/'], check=True)
+
+
+class Machine:
+    def __init__(self, ns, workdir: str):
+        self.serial_path = os.path.join(workdir, 'serial.bin')
+        self.monitor_path = os.path.join(workdir, 'monitor.sock')
+        self.serial_pos = 0
+        self.timeout = ns.timeout
+
+        disk = os.path.join(workdir, 'disk.img')
+        make_image(disk, ns.loader, ns.kernel, ns.file)
+        vars_copy = os.path.join(workdir, 'OVMF_VARS.fd')
+        shutil.copy(ns.ovmf_vars, vars_copy)
+
+        self.proc = subprocess.Popen([
+            ns.qemu, '-m', '1G', '-display', 'none', '-no-reboot',
+            '-drive', 'if=pflash,format=raw,readonly=on,file=' + ns.ovmf_code,
+            '-drive', 'if=pflash,format=raw,file=' + vars_copy,
+            '-drive', 'if=ide,index=0,media=disk,format=raw,file=' + disk,
+            '-device', 'nec-usb-xhci,id=xhci',
+            '-device', 'usb-mouse', '-device', 'usb-kbd',
+            '-serial', 'file:' + self.serial_path,
+            '-monitor', 'unix:{},server,nowait'.format(self.monitor_path),
+        ])
+
+        deadline = time.time() + self.timeout
+        while True:
+            try:
+                self.monitor = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+                self.monitor.connect(self.monitor_path)
+                break
+            except OSError:
+                if time.time() > deadline:
+                    raise RuntimeError('cannot connect to the QEMU monitor')
+                time.sleep(0.1)
+        self.monitor.settimeout(0.1)
+
+    def command(self, line: str):
+        self.monitor.sendall(line.encode() + b'\n')
+        # 応答は使わないが、溜まらないように読み捨てる
+        try:
+            while self.monitor.recv(4096):
+                pass
+        except socket.timeout:
+            pass
+
+    def type(self, text: str):
+        for c in text:
+            self.command('sendkey ' + key_name(c))
+
+    def enter(self, line: str):
+        self.type(line)
+        self.command('sendkey ret')
+
+    def wait_serial(self, header, end_mark=None) -> tuple:
+        """シリアルの出力に header が現れる（end_mark があればそれも現れる）まで待ち、
+        header の一致と、header から end_mark までのバイト列を返す"""
+        deadline = time.time() + self.timeout
+        while time.time() < deadline:
+            with open(self.serial_path, 'rb') as f:
+                f.seek(self.serial_pos)
+                data = f.read()
+            m = header.search(data)
+            if m and end_mark is None:
+                self.serial_pos += m.end()
+                return m, b''
+            end = data.find(end_mark, m.end()) if m else -1
+            if end >= 0:
+                self.serial_pos += end + len(end_mark)
+                return m, data[m.end():end]
+            time.sleep(0.2)
+        raise RuntimeError('timed out waiting for {!r}'.format(header.pattern))
+
+    def capture(self, area: list) -> dict:
+        self.enter('capture ' + ' '.join(str(v) for v in area) if area else 'capture')
+        m, payload = self.wait_serial(CAPTURE_HEADER, CAPTURE_END)
+        x, y, w, h, frames, avg_us, max_us = (int(v) for v in m.groups())
+        return {
+            'area': [x, y, w, h],
+            'image': read_ppm(payload),
+            'frames': frames, 'avg_us': avg_us, 'max_us': max_us,
+        }
+
+    def save_input(self) -> bytes:
+        self.enter('input save')
+        m, payload = self.wait_serial(INPUT_HEADER, CAPTURE_END)
+        if len(payload) != int(m.group(1)):
+            raise RuntimeError('truncated input record')
+        return payload
+
+    def replay(self, speed: int) -> dict:
+        self.enter('input replay {}'.format(speed))
+        m, _ = self.wait_serial(REPLAY_LINE)
+        events, elapsed_us = (int(v) for v in m.groups())
+        return {'events': events, 'elapsed_us': elapsed_us}
+
+    def close(self):
+        self.proc.kill()
+        self.proc.wait()
+
+
+def run(ns, machine: Machine) -> tuple:
+    failures = []
+    perf = {}
+    with open(ns.script) as script:
+        lines = script.read().splitlines()
+
+    for lineno, line in enumerate(lines, 1):
+        line = line.split('#', 1)[0].strip()
+        if not line:
+            continue
+        op, _, rest = line.partition(' ')
+        args = rest.split()
+
+        if op == 'wait':
+            time.sleep(float(args[0]))
+        elif op == 'type':
+            machine.type(rest)
+        elif op == 'key':
+            for k in args:
+                machine.command('sendkey ' + k)
+        elif op == 'mouse':
+            machine.command('mouse_move {} {}'.format(int(args[0]), int(args[1])))
+        elif op == 'click':
+            machine.command('mouse_button 1')
+            machine.command('mouse_button 0')
+        elif op == 'reset':
+            machine.enter('capture reset')
+        elif op == 'record':
+            machine.enter('input record')
+        elif op == 'stop':
+            machine.enter('input stop')
+        elif op == 'save':
+            with open(os.path.join(ns.out, args[0] + '.inp'), 'wb') as f:
+                f.write(machine.save_input())
+        elif op == 'load':
+            machine.enter('input load ' + args[0])
+        elif op == 'replay':
+            perf[args[0]] = machine.replay(int(args[1]) if len(args) > 1 else 1)
+        elif op == 'capture':
+            name = args[0]
+            result = machine.capture([int(v) for v in args[1:5]])
+            perf[name] = {k: result[k] for k in ('frames', 'avg_us', 'max_us')}
+            w, h, pixels = result['image']
+            write_ppm(os.path.join(ns.out, name + '.ppm'), w, h, pixels)
+
+            golden = os.path.join(ns.golden, name + '.ppm')
+            if ns.update:
+                write_ppm(golden, w, h, pixels)
+                continue
+            if not os.path.exists(golden):
+                # 正解画像はまだコミットしていないので、無ければ比べずに進める。--update で作る
+                print('WARN {}: no golden image {}, skipped (run with --update to create it)'.format(
+                    name, golden), file=sys.stderr)
+                continue
+            with open(golden, 'rb') as f:
+                expected = read_ppm(f.read())
+            count, diff = compare(result['image'], expected)
+            if count > ns.max_diff_pixels:
+                failures.append('{}: {} pixels differ'.format(name, count))
+                if diff:
+                    write_ppm(os.path.join(ns.out, name + '.diff.ppm'), w, h, diff)
+        else:
+            raise ValueError('{}:{}: unknown command {!r}'.format(ns.script, lineno, op))
+
+    return failures, perf
+
+
+def check_perf(perf: dict, baseline: dict, tolerance: float) -> list:
+    failures = []
+    for name, values in perf.items():
+        base = baseline.get(name, {})
+        # capture は合成の平均時間、replay は再生にかかった時間を比べる
+        for key, label in (('avg_us', 'compose avg'), ('elapsed_us', 'replay')):
+            if key not in values or not base.get(key):
+                continue
+            if values[key] > base[key] * tolerance:
+                failures.append('{}: {} {} us (baseline {} us)'.format(
+                    name, label, values[key], base[key]))
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('script', help='path to an input script')
+    parser.add_argument('--kernel', required=True, help='path to kernel.elf')
+    parser.add_argument('--loader', required=True, help='path to the boot loader (Loader.efi)')
+    parser.add_argument('--ovmf-code', required=True, help='path to OVMF_CODE.fd')
+    parser.add_argument('--ovmf-vars', required=True, help='path to OVMF_VARS.fd')
+    parser.add_argument('--file', action='append', default=[], help='extra file to put on the disk')
+    parser.add_argument('--golden', default='golden', help='directory of golden images')
+    parser.add_argument('--out', default='capture_out', help='directory for captures and reports')
+    parser.add_argument('--update', action='store_true', help='overwrite golden images with captures')
+    parser.add_argument('--max-diff-pixels', type=int, default=0)
+    parser.add_argument('--perf-baseline', help='perf.json of a previous run to compare with')
+    parser.add_argument('--perf-tolerance', type=float, default=1.5,
+                        help='fail when compose or replay time exceeds baseline by this factor')
+    parser.add_argument('--qemu', default='qemu-system-x86_64')
+    parser.add_argument('--timeout', type=float, default=60)
+    ns = parser.parse_args()
+
+    os.makedirs(ns.out, exist_ok=True)
+    os.makedirs(ns.golden, exist_ok=True)
+
+    with tempfile.TemporaryDirectory() as workdir:
+        machine = Machine(ns, workdir)
+        try:
+            failures, perf = run(ns, machine)
+        finally:
+            machine.close()
+
+    with open(os.path.join(ns.out, 'perf.json'), 'w') as f:
+        json.dump(perf, f, indent=2)
+    for name, values in perf.items():
+        if 'elapsed_us' in values:
+            print('{}: replayed {} events in {} us'.format(name, values['events'], values['elapsed_us']))
+        else:
+            print('{}: {} frames, avg {} us, max {} us'.format(
+                name, values['frames'], values['avg_us'], values['max_us']))
+
+    if ns.perf_baseline:
+        with open(ns.perf_baseline) as f:
+            failures += check_perf(perf, json.load(f), ns.perf_tolerance)
+
+    for failure in failures:
+        print('FAIL ' + failure, file=sys.stderr)
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
\ No newline at end of file
@@ -10,31 +10,128 @@ import sys
 BITMAP_PATTERN = re.compile(r'([.*@]+)')
 
 
-def compile(src: str) -> bytes:
+def parse(src: str) -> list:
+    """フォントファイルを、グリフごとの行のビット列（各行は '.' 以外を 1 とした文字列）のリストにする"""
     src = src.lstrip()
-    result = []
+    glyphs = []
+    rows = []
 
     for line in src.splitlines():
         m = BITMAP_PATTERN.match(line)
         if not m:
+            if rows:
+                glyphs.append(rows)
+                rows = []
             continue
 
-        bits = [(0 if x == '.' else 1) for x in m.group(1)]
-        bits_int = functools.reduce(lambda a, b: 2*a + b, bits)
-        result.append(bits_int.to_bytes(1, byteorder='little'))
+        rows.append([(0 if x == '.' else 1) for x in m.group(1)])
+
+    if rows:
+        glyphs.append(rows)
+
+    return glyphs
+
+
+def compile(src: str) -> bytes:
+    result = []
+
+    for rows in parse(src):
+        for bits in rows:
+            bits_int = functools.reduce(lambda a, b: 2*a + b, bits)
+            result.append(bits_int.to_bytes(1, byteorder='little'))
 
     return b''.join(result)
 
 
+def row_spans(bits: list) -> list:
+    """1 が連続する範囲を (開始位置, 長さ) のリストにする"""
+    spans = []
+    x = 0
+    while x < len(bits):
+        if bits[x]:
+            start = x
+            while x < len(bits) and bits[x]:
+                x += 1
+            spans.append((start, x - start))
+        else:
+            x += 1
+    return spans
+
+
+def compile_cpp(src: str, name: str, source_name: str) -> str:
+    glyphs = parse(src)
+    if not glyphs:
+        raise ValueError('no glyphs found')
+
+    height = len(glyphs[0])
+    width = max(len(bits) for rows in glyphs for bits in rows)
+    if width > 32:
+        raise ValueError('glyphs wider than 32 pixels are not supported')
+    for i, rows in enumerate(glyphs):
+        if len(rows) != height:
+            raise ValueError('glyph 0x{:02x} has {} rows (expected {})'.format(i, len(rows), height))
+
+    glyph_lines = []
+    span_lines = []
+    num_spans = 0
+    for i, rows in enumerate(glyphs):
+        masks = []
+        nonempty = []
+        span_begin = num_spans
+        for y, bits in enumerate(rows):
+            bits = bits + [0] * (width - len(bits))
+            masks.append(functools.reduce(lambda a, b: 2*a + b, bits))
+            if any(bits):
+                nonempty.append(y)
+            for x, length in row_spans(bits):
+                span_lines.append('    {{{}, {}, {}}},'.format(y, x, length))
+                num_spans += 1
+
+        first_row = nonempty[0] if nonempty else 0
+        last_row = nonempty[-1] + 1 if nonempty else 0
+        glyph_lines.append('    {{{{{}}}, {}, {}, {}, {}}},  // 0x{:02x}'.format(
+            ', '.join('0x{:0{}x}'.format(m, (width + 3) // 4) for m in masks),
+            first_row, last_row, span_begin, num_spans, i))
+
+    if num_spans == 0:
+        span_lines.append('    {0, 0, 0},')
+        num_spans = 1
+
+    return '\n'.join([
+        '// {} から tools/makefont.py で生成したファイル。直接編集しないこと'.format(source_name),
+        '#pragma once',
+        '',
+        '#include "font.hpp"',
+        '',
+        'inline constexpr Font<{}, {}, {}, {}> {}{{'.format(width, height, len(glyphs), num_spans, name),
+        '  {',
+        *glyph_lines,
+        '  },',
+        '  {',
+        *span_lines,
+        '  },',
+        '};',
+    ])
+
+
 def main():
     parser = argparse.ArgumentParser()
     parser.add_argument('font', help='path to a font file')
     parser.add_argument('-o', help='path to an output file', default='font.out')
+    parser.add_argument('--format', choices=['bin', 'cpp'], default='bin',
+                        help='raw bitmap or a C++ header with constexpr tables')
+    parser.add_argument('--name', default='kFont', help='variable name for --format cpp')
     ns = parser.parse_args()
 
-    with open(ns.o, 'wb') as out, open(ns.font) as font:
+    with open(ns.font) as font:
         src = font.read()
-        out.write(compile(src))
+
+    if ns.format == 'cpp':
+        with open(ns.o, 'w') as out:
+            out.write(compile_cpp(src, ns.name, ns.font.split('/')[-1]))
+    else:
+        with open(ns.o, 'wb') as out:
+            out.write(compile(src))
 
 
 if __name__ == '__main__':